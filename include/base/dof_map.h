@@ -39,6 +39,8 @@
 #include <map>
 #include <string>
 #include <vector>
+#include LIBMESH_INCLUDE_UNORDERED_MAP
+#include LIBMESH_INCLUDE_UNORDERED_MULTIMAP
 
 namespace libMesh
 {
@@ -60,6 +62,7 @@ class System;
 template <typename T> class DenseVectorBase;
 template <typename T> class DenseVector;
 template <typename T> class DenseMatrix;
+template <typename T, unsigned int M, unsigned int N> class FixedDenseMatrix;
 template <typename T> class SparseMatrix;
 template <typename T> class NumericVector;
 
@@ -98,6 +101,87 @@ class DofConstraints : public std::map<dof_id_type,
 {
 };
 
+/**
+ * A read-only compressed sparse row copy of \p DofConstraints.  The
+ * constrained dofs are kept sorted in one array and the coefficients
+ * of each row are stored contiguously, so finding and traversing a
+ * constraint row touches a few flat arrays instead of two levels of
+ * trees.  The DofMap builds one at the end of process_constraints(),
+ * once every constraint is expressed in terms of unconstrained dofs.
+ */
+class CompressedDofConstraints
+{
+public:
+
+  /**
+   * Constructor.  The copy is empty and unbuilt.
+   */
+  CompressedDofConstraints () : _built(false) {}
+
+  /**
+   * Replaces any existing copy with a copy of \p constraints.
+   */
+  void build (const DofConstraints &constraints);
+
+  /**
+   * Discards the copy, because the constraints it was built from
+   * have changed.
+   */
+  void clear ();
+
+  /**
+   * Returns true if the copy has been built since it was last
+   * cleared.
+   */
+  bool built () const { return _built; }
+
+  /**
+   * Returns the number of constrained dofs.
+   */
+  std::size_t n_rows () const { return _dofs.size(); }
+
+  /**
+   * Returns the index of the constraint row for \p dof, or \p n_rows()
+   * if \p dof is unconstrained.
+   */
+  std::size_t row (const dof_id_type dof) const
+  {
+    const std::vector<dof_id_type>::const_iterator it =
+      std::lower_bound (_dofs.begin(), _dofs.end(), dof);
+    if (it == _dofs.end() || *it != dof)
+      return this->n_rows();
+    return std::distance (_dofs.begin(), it);
+  }
+
+  /**
+   * The entries of row \p r are those with indices from
+   * \p row_begin(r) up to \p row_end(r).
+   */
+  std::size_t row_begin (const std::size_t r) const { return _row_starts[r]; }
+  std::size_t row_end (const std::size_t r) const { return _row_starts[r+1]; }
+
+  /**
+   * Returns the dof and the coefficient of entry \p k.
+   */
+  dof_id_type constraining_dof (const std::size_t k) const { return _constraining_dofs[k]; }
+  Real coefficient (const std::size_t k) const { return _coefficients[k]; }
+
+  /**
+   * Returns the right hand side of row \p r.
+   */
+  Number rhs (const std::size_t r) const { return _rhs[r]; }
+
+private:
+
+  bool _built;
+
+  std::vector<dof_id_type> _dofs;
+  std::vector<std::size_t> _row_starts;
+  std::vector<dof_id_type> _constraining_dofs;
+  std::vector<Real>        _coefficients;
+  std::vector<Number>      _rhs;
+};
+
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
 /**
  * A row of the Node constraint mapping.  Currently this just
@@ -207,6 +291,29 @@ public:
    */
   void distribute_dofs (MeshBase&);
 
+  /**
+   * Fills \p elems with the active local elements of \p mesh, in
+   * the order in which \p distribute_dofs() numbers their degrees of
+   * freedom.  This is the \p ordering given by the \p --dof_ordering
+   * command line option, \p "mesh" if there is none.
+   */
+  void order_local_elements (MeshBase& mesh,
+			     std::vector<Elem*>& elems) const;
+
+  /**
+   * Fills \p elems with the active local elements of \p mesh in the
+   * given \p ordering:  \p "mesh" keeps the order of the mesh
+   * iterators, \p "rcm" is a reverse Cuthill-McKee ordering of the
+   * local element adjacency graph, which reduces the bandwidth of the
+   * local block of the resulting matrices, and \p "hilbert" follows
+   * a Hilbert curve through the element centroids, which improves
+   * locality and reduces the profile but does not bound the
+   * bandwidth.
+   */
+  void order_local_elements (MeshBase& mesh,
+			     std::vector<Elem*>& elems,
+			     const std::string& ordering) const;
+
   /**
    * Computes the sparsity pattern for the matrices corresponding to
    * \p proc_id and sends that data to Linear Algebra packages for
@@ -436,6 +543,21 @@ public:
 		    std::vector<dof_id_type>& di,
 		    const unsigned int vn = libMesh::invalid_uint) const;
 
+  /**
+   * Returns the active local elements of \p mesh grouped by color, so
+   * that no two elements of the same color share a degree of freedom,
+   * either directly or through constraint equations.  The elements of
+   * each color may therefore be assembled concurrently without
+   * conflicting writes.
+   *
+   * The coloring is computed greedily on first use and cached until
+   * the degrees of freedom or constraints are next redistributed,
+   * e.g. after mesh refinement.  It must not be first requested from
+   * within a threaded loop.
+   */
+  const std::vector<std::vector<const Elem*> > &
+  local_elem_colors (const MeshBase& mesh) const;
+
   /**
    * Fills the vector \p di with the global degree of freedom indices
    * corresponding to the SCALAR variable vn. If old_dofs=true,
@@ -639,6 +761,21 @@ public:
 				 std::vector<dof_id_type>& elem_dofs,
 				 bool asymmetric_constraint_rows = true) const;
 
+  /**
+   * Constrains the fixed-size element matrix \p matrix.  Most
+   * elements have no constrained degrees of freedom, so if none of
+   * the \p elem_dofs is constrained this method does nothing and
+   * returns false, and \p matrix may be added to the global matrix
+   * as it is.  Otherwise \p matrix is copied into
+   * \p constrained_matrix, which is then constrained (possibly
+   * growing \p elem_dofs) as above, and true is returned.
+   */
+  template <unsigned int N>
+  bool constrain_element_matrix (const FixedDenseMatrix<Number,N,N>& matrix,
+				 std::vector<dof_id_type>& elem_dofs,
+				 DenseMatrix<Number>& constrained_matrix,
+				 bool asymmetric_constraint_rows = true) const;
+
   /**
    * Constrains the element matrix.  This method allows the
    * element matrix to be non-square, in which case the row_dofs
@@ -909,12 +1046,14 @@ private:
    * Distributes the global degrees of freedom, for dofs on
    * this processor.  In this format the local
    * degrees of freedom are in a contiguous block for each
-   * variable in the system.
+   * variable group in the system.
+   * The elements \p local_elems are numbered in order.
    * Starts at index next_free_dof, and increments it to
    * the post-final index.
    */
   void distribute_local_dofs_var_major (dof_id_type& next_free_dof,
-				        MeshBase& mesh);
+				        MeshBase& mesh,
+				        const std::vector<Elem*>& local_elems);
 
   /**
    * Distributes the global degrees of freedom, for dofs on
@@ -923,13 +1062,13 @@ private:
    * blocks.  Note in particular that the degrees of freedom
    * for a given variable are not in contiguous blocks, as
    * in the case of \p distribute_local_dofs_var_major.
+   * The elements \p local_elems are numbered in order.
    * Starts at index next_free_dof, and increments it to
    * the post-final index.
-   * If build_send_list is true, builds the send list.  If
-   * false, clears and reserves the send list
    */
   void distribute_local_dofs_node_major (dof_id_type& next_free_dof,
-				         MeshBase& mesh);
+				         MeshBase& mesh,
+				         const std::vector<Elem*>& local_elems);
 
   /**
    * Adds entries to the \p _send_list vector corresponding to DoFs
@@ -987,6 +1126,38 @@ private:
    */
   void add_constraints_to_send_list();
 
+  /**
+   * The constraint operator of one element: the element dofs with
+   * the dofs they are constrained in terms of appended, and the
+   * row-major \p n_elem_dofs by \p dofs.size() matrix \p C and vector
+   * \p H for which the element values are C times the expanded
+   * values plus H.
+   */
+  struct ElemConstraintOperator
+  {
+    std::size_t n_elem_dofs;
+    std::vector<dof_id_type> dofs;
+    std::vector<Number> C;
+    std::vector<Number> H;
+  };
+
+  /**
+   * Returns the cached constraint operator for the element dofs
+   * \p elem_dofs, building and caching it first if need be, or NULL
+   * if none of them are constrained.  Requires the compressed
+   * constraints to have been built.  Safe to call from several
+   * threads at once.
+   */
+  const ElemConstraintOperator *
+  elem_constraint_operator (const std::vector<dof_id_type> &elem_dofs) const;
+
+  /**
+   * Discards the compressed constraints and the cached element
+   * constraint operators, because the constraints or the dof
+   * numbering have changed.
+   */
+  void clear_constraint_operators ();
+
 #endif // LIBMESH_ENABLE_CONSTRAINTS
   
   /**
@@ -1096,6 +1267,13 @@ private:
    */
   dof_id_type _n_SCALAR_dofs;
 
+  /**
+   * Cached coloring of the active local elements, built on demand by
+   * \p local_elem_colors() and cleared whenever dofs or constraints
+   * change.
+   */
+  mutable std::vector<std::vector<const Elem*> > _local_elem_colors;
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -1121,6 +1299,24 @@ private:
    * entry is the constraint matrix row for DOF i.
    */
   DofConstraints _dof_constraints;
+
+  /**
+   * Compressed copy of \p _dof_constraints, built by
+   * process_constraints() and cleared whenever they change.
+   */
+  CompressedDofConstraints _compressed_constraints;
+
+  /**
+   * Element constraint operators built from
+   * \p _compressed_constraints, keyed by a hash of the element dofs.
+   * Entries are added on demand by assembly threads, under
+   * \p _constraint_operator_mutex, and are only removed along with
+   * the compressed constraints.
+   */
+  typedef LIBMESH_BEST_UNORDERED_MULTIMAP<std::size_t, ElemConstraintOperator>
+    ElemConstraintOperatorCache;
+  mutable ElemConstraintOperatorCache _elem_constraint_operators;
+  mutable Threads::spin_mutex _constraint_operator_mutex;
 #endif
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1241,12 +1437,50 @@ node
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  if (_compressed_constraints.built())
+    return (_compressed_constraints.row(dof) !=
+            _compressed_constraints.n_rows());
+
   if (_dof_constraints.count(dof))
     return true;
 
   return false;
 }
 
+
+
+template <unsigned int N>
+inline
+bool DofMap::constrain_element_matrix (const FixedDenseMatrix<Number,N,N>& matrix,
+				       std::vector<dof_id_type>& elem_dofs,
+				       DenseMatrix<Number>& constrained_matrix,
+				       bool asymmetric_constraint_rows) const
+{
+  libmesh_assert_equal_to (elem_dofs.size(), N);
+
+  // check for easy return
+  if (this->_dof_constraints.empty())
+    return false;
+
+  bool has_constrained_dofs = false;
+  for (unsigned int i=0; i != N; i++)
+    if (this->is_constrained_dof(elem_dofs[i]))
+      {
+	has_constrained_dofs = true;
+	break;
+      }
+
+  if (!has_constrained_dofs)
+    return false;
+
+  matrix.get_dense_matrix (constrained_matrix);
+
+  this->constrain_element_matrix (constrained_matrix, elem_dofs,
+				  asymmetric_constraint_rows);
+
+  return true;
+}
+
 #else
 
   //--------------------------------------------------------------------
@@ -1263,6 +1497,12 @@ inline void DofMap::constrain_element_matrix (DenseMatrix<Number>&,
 				              std::vector<dof_id_type>&,
 				              bool) const {}
 
+template <unsigned int N>
+inline bool DofMap::constrain_element_matrix (const FixedDenseMatrix<Number,N,N>&,
+				              std::vector<dof_id_type>&,
+				              DenseMatrix<Number>&,
+				              bool) const { return false; }
+
 inline void DofMap::constrain_element_vector (DenseVector<Number>&,
 				              std::vector<dof_id_type>&,
 				              bool) const {}
@@ -26,6 +26,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/slab_allocator.h"
 
 // C++ includes
 #include <cstddef>
@@ -80,6 +81,21 @@ protected:
 
 public:
 
+#ifdef LIBMESH_ENABLE_SLAB_ALLOCATION
+
+  /**
+   * Nodes and elements are allocated from the \p SlabPool, so that
+   * objects of the same size class are packed contiguously in memory
+   * in creation order rather than scattered across the heap.
+   */
+  static void * operator new (std::size_t size)
+  { return SlabPool::allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { SlabPool::deallocate(p, size); }
+
+#endif
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -422,7 +438,11 @@ private:
    * (Now of course 0-base everything...  but you get the idea.)
    */
   typedef dof_id_type index_t;
+#ifdef LIBMESH_ENABLE_SLAB_ALLOCATION
+  typedef std::vector<index_t, SlabAllocator<index_t> > index_buffer_t;
+#else
   typedef std::vector<index_t> index_buffer_t;
+#endif
   index_buffer_t _idx_buf;
 
   /**
@@ -450,7 +470,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> &buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -53,12 +53,20 @@ class PerfLog;
 // to add performance monitors to the code without
 // impacting performance when performance logging
 // is disabled.
+//
+// Each macro looks up its event id only the first time it is
+// reached and caches it in a static variable, so \p a and \p b
+// must be the same strings every time a given macro is executed.
+// Call libMesh::perflog.push() and pop() directly for event names
+// computed at run time.
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
 
 // Note the log is in libMesh, so we need to include it.
 #  include "libmesh/libmesh.h"
-#  define START_LOG(a,b)   { libMesh::perflog.push(a,b); }
-#  define STOP_LOG(a,b)    { libMesh::perflog.pop(a,b); }
+#  define START_LOG(a,b)   { static const unsigned int libmesh_log_event = libMesh::perflog.event_id(a,b); \
+                             libMesh::perflog.push(libmesh_log_event); }
+#  define STOP_LOG(a,b)    { static const unsigned int libmesh_log_event = libMesh::perflog.event_id(a,b); \
+                             libMesh::perflog.pop(libmesh_log_event); }
 #  define PALIBMESH_USE_LOG(a,b)   { libmesh_deprecated(); }
 #  define RESTART_LOG(a,b) { libmesh_deprecated(); }
 
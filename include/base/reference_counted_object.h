@@ -79,7 +79,7 @@ protected:
   {
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
-    increment_constructor_count(typeid(T).name());
+    increment_constructor_count(_class_counts);
 
 #endif
   }
@@ -92,7 +92,7 @@ protected:
   {
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
-    increment_constructor_count(typeid(T).name());
+    increment_constructor_count(_class_counts);
 
 #endif
   }
@@ -106,16 +106,36 @@ public:
   {
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
-    increment_destructor_count(typeid(T).name());
+    increment_destructor_count(_class_counts);
 
 #endif
   }
 
 private:
 
+#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+
+  /**
+   * The counts for class \p T.  A static data member rather than a
+   * function-local static, so that it is registered during static
+   * initialization rather than by whichever thread first creates a
+   * \p T.
+   */
+  static ClassCounts _class_counts;
+
+#endif
 };
 
 
+
+#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+
+template <typename T>
+ReferenceCounter::ClassCounts ReferenceCountedObject<T>::_class_counts (typeid(T).name());
+
+#endif
+
+
 } // namespace libMesh
 
 
@@ -91,31 +91,59 @@ protected:
 
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
+  /**
+   * Creation and destruction counts for one reference counted class.
+   * Each \p ReferenceCountedObject<T> keeps a single static instance,
+   * which registers itself in \p _counts during static
+   * initialization, so counting an object is an atomic increment
+   * rather than a locked lookup by class name.
+   */
+  class ClassCounts
+  {
+  public:
+    /**
+     * Constructor.  Registers these counts under \p class_name.
+     * The counters are only zero if this object has static storage
+     * duration.
+     */
+    explicit ClassCounts (const char* class_name);
+
+    const char* name;
+
+    Threads::atomic<unsigned int> constructions;
+
+    Threads::atomic<unsigned int> destructions;
+
+    /**
+     * The next registered set of counts.
+     */
+    ClassCounts* next;
+  };
+
   /**
    * Increments the construction counter. Should be called in
    * the constructor of any derived class that will be
    * reference counted.
    */
-  void increment_constructor_count (const std::string& name);
+  static void increment_constructor_count (ClassCounts& counts)
+  { counts.constructions++; }
 
   /**
    * Increments the destruction counter. Should be called in
    * the destructor of any derived class that will be
    * reference counted.
    */
-  void increment_destructor_count (const std::string& name);
+  static void increment_destructor_count (ClassCounts& counts)
+  { counts.destructions++; }
 
   /**
-   * Data structure to log the information.  The log is
-   * identified by the class name.
+   * The most recently registered counts, heading a list of all of
+   * them.  A plain pointer, which needs no dynamic initialization,
+   * since classes register during static initialization in an
+   * unspecified order.  The counts of every class are only collected
+   * by name in \p get_info().
    */
-  typedef std::map<std::string, std::pair<unsigned int,
-					  unsigned int> > Counts;
-
-  /**
-   * Actually holds the data.
-   */
-  static Counts _counts;
+  static ClassCounts* _counts;
 
 #endif
 
@@ -126,7 +154,8 @@ protected:
   static Threads::atomic<unsigned int> _n_objects;
 
   /**
-   * Mutual exclusion object to enable thread-safe reference counting.
+   * Mutual exclusion object to enable thread-safe registration and
+   * reporting of the class counts.
    */
   static Threads::spin_mutex _mutex;
 
@@ -154,35 +183,6 @@ inline ReferenceCounter::~ReferenceCounter()
 }
 
 
-
-
-
-
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
-inline
-void ReferenceCounter::increment_constructor_count (const std::string& name)
-{
-  Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-  std::pair<unsigned int, unsigned int>& p = _counts[name];
-
-  p.first++;
-}
-#endif
-
-
-
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
-inline
-void ReferenceCounter::increment_destructor_count (const std::string& name)
-{
-  Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-  std::pair<unsigned int, unsigned int>& p = _counts[name];
-
-  p.second++;
-}
-#endif
-
-
 } // namespace libMesh
 
 
@@ -26,6 +26,7 @@
 // C++ includes
 #include <cstddef>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace libMesh
@@ -54,7 +55,7 @@ public:
    * pointer to NULL.  Defaults to L2 norm; changes to system norm are
    * ignored.
    */
-  DiscontinuityMeasure() : _bc_function(NULL) { error_norm = L2; }
+  DiscontinuityMeasure() : my_system(NULL), _bc_function(NULL) { error_norm = L2; }
 
   /**
    * Destructor.
@@ -92,6 +93,19 @@ protected:
    */
   virtual bool boundary_side_integration();
 
+  /**
+   * Returns a copy of this estimator, for use on a single thread.
+   * A copy of a further derived class would lose its overrides, so
+   * unless that class provides its own \p clone() we return NULL and
+   * its face integrations stay on the calling thread.
+   */
+  virtual AutoPtr<JumpErrorEstimator> clone() const
+  {
+    if (typeid(*this) != typeid(DiscontinuityMeasure))
+      return AutoPtr<JumpErrorEstimator>(NULL);
+    return AutoPtr<JumpErrorEstimator>(new DiscontinuityMeasure(*this));
+  }
+
   /**
    * A pointer to the current System
    */
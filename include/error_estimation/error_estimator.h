@@ -146,6 +146,13 @@ protected:
    * them to get the global error vector.
    */
   void reduce_error (std::vector<float>& error_per_cell) const;
+
+  /**
+   * As above, except that the contributions to a distributed
+   * \p error_per_cell are only exchanged between the processors
+   * which own or ghost each element.
+   */
+  void reduce_error (ErrorVector& error_per_cell) const;
 };
 
 
@@ -26,6 +26,7 @@
 // C++ includes
 #include <vector>
 #include <string>
+#include <typeinfo>
 
 namespace libMesh
 {
@@ -73,6 +74,19 @@ protected:
    * term on an internal side
    */
   virtual void internal_side_integration();
+
+  /**
+   * Returns a copy of this estimator, for use on a single thread.
+   * A copy of a further derived class would lose its overrides, so
+   * unless that class provides its own \p clone() we return NULL and
+   * its face integrations stay on the calling thread.
+   */
+  virtual AutoPtr<JumpErrorEstimator> clone() const
+  {
+    if (typeid(*this) != typeid(LaplacianErrorEstimator))
+      return AutoPtr<JumpErrorEstimator>(NULL);
+    return AutoPtr<JumpErrorEstimator>(new LaplacianErrorEstimator(*this));
+  }
 };
 
 
@@ -23,7 +23,9 @@
 // Local Includes
 #include "libmesh/auto_ptr.h"
 #include "libmesh/dense_vector.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/error_estimator.h"
+#include "libmesh/error_vector.h"
 #include "libmesh/fe_base.h"
 
 // C++ includes
@@ -46,6 +48,12 @@ class Elem;
  * This abstract base class implements utility functions for error estimators
  * which are based on integrated jumps between elements.
  *
+ * The face integrations are split between threads when the most
+ * derived class provides a \p clone() method; each thread then works
+ * with its own copy of the estimator, and so with its own finite
+ * element objects and per-face data.  Any user-supplied boundary condition
+ * functions must be thread-safe in that case.
+ *
  * @author Roy H. Stogner, 2006
  */
 class JumpErrorEstimator : public ErrorEstimator
@@ -60,6 +68,19 @@ public:
       integrate_boundary_sides(false),
       fe_fine(NULL), fe_coarse(NULL) {}
 
+  /**
+   * Copy constructor.  The estimator settings are copied; the finite
+   * element objects and per-face data are not.
+   */
+  JumpErrorEstimator(const JumpErrorEstimator& other)
+    : ErrorEstimator(other),
+      scale_by_n_flux_faces(other.scale_by_n_flux_faces),
+      integrate_boundary_sides(other.integrate_boundary_sides),
+      fine_elem(NULL), coarse_elem(NULL),
+      fine_error(0), coarse_error(0),
+      fine_side(0), var(0),
+      fe_fine(NULL), fe_coarse(NULL) {}
+
   /**
    * Destructor.
    */
@@ -88,6 +109,15 @@ public:
   bool scale_by_n_flux_faces;
 
 protected:
+  /**
+   * Returns a new copy of this estimator, to be used by a single
+   * thread.  The default implementation returns a NULL pointer, in
+   * which case the face integrations are all done on the calling
+   * thread.
+   */
+  virtual AutoPtr<JumpErrorEstimator> clone() const
+  { return AutoPtr<JumpErrorEstimator>(NULL); }
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -155,6 +185,82 @@ protected:
    * The finite element objects for fine and coarse elements
    */
   AutoPtr<FEBase> fe_fine, fe_coarse;
+
+ private:
+
+  /**
+   * Class to compute the jump contributions for a range of elements.
+   * May be split and executed in parallel on separate threads.  The
+   * original body accumulates into vectors indexed by element id;
+   * each split only records the contributions it computes, which
+   * \p join() adds to the vectors, so splitting costs nothing
+   * proportional to the size of the mesh.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System& sys,
+		   JumpErrorEstimator &ee,
+		   ErrorVector& epc,
+		   bool estimate_parent,
+		   AutoPtr<JumpErrorEstimator> thread_ee);
+
+    EstimateError (EstimateError &other, Threads::split);
+
+    void operator()(const ConstElemRange &range);
+
+    void join (const EstimateError &other);
+
+    /**
+     * The accumulated squared error contributions, indexed by element
+     * id and distributed like the output vector.  Empty in split
+     * bodies.
+     */
+    ErrorVector error_sums;
+
+    /**
+     * The accumulated number of flux faces, indexed by element id.
+     * Empty in split bodies.
+     */
+    ErrorVector n_flux_faces;
+
+  private:
+
+    /**
+     * Adds \p error and \p flux_faces to the sums for element \p id.
+     */
+    void add (dof_id_type id, ErrorVectorReal error, ErrorVectorReal flux_faces);
+
+    /**
+     * The contributions to one element recorded by a split body.
+     */
+    struct Contribution
+    {
+      dof_id_type id;
+      ErrorVectorReal error;
+      ErrorVectorReal flux_faces;
+    };
+
+    std::vector<Contribution> contributions;
+
+    /**
+     * True for split bodies, which only record contributions.
+     */
+    const bool is_split;
+
+    /**
+     * The copy of the estimator used by this body, when working on
+     * more than one thread.
+     */
+    AutoPtr<JumpErrorEstimator> thread_estimator;
+
+    const System &system;
+    JumpErrorEstimator &error_estimator;
+    ErrorVector &error_per_cell;
+    const bool estimate_parent_error;
+  };
+
+  friend class EstimateError;
 };
 
 
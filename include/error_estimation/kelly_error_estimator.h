@@ -26,6 +26,7 @@
 // C++ includes
 #include <cstddef>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace libMesh
@@ -67,7 +68,7 @@ public:
    * pointer to NULL.  Defaults to H1 seminorm; changes to system norm
    * are ignored.
    */
-  KellyErrorEstimator() : _bc_function(NULL)
+  KellyErrorEstimator() : my_system(NULL), _bc_function(NULL)
   { error_norm = H1_SEMINORM; }
 
   /**
@@ -106,6 +107,19 @@ protected:
    */
   virtual bool boundary_side_integration();
 
+  /**
+   * Returns a copy of this estimator, for use on a single thread.
+   * A copy of a further derived class would lose its overrides, so
+   * unless that class provides its own \p clone() we return NULL and
+   * its face integrations stay on the calling thread.
+   */
+  virtual AutoPtr<JumpErrorEstimator> clone() const
+  {
+    if (typeid(*this) != typeid(KellyErrorEstimator))
+      return AutoPtr<JumpErrorEstimator>(NULL);
+    return AutoPtr<JumpErrorEstimator>(new KellyErrorEstimator(*this));
+  }
+
   /**
    * A pointer to the current System
    */
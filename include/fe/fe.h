@@ -455,6 +455,17 @@ protected:
   virtual void init_shape_functions(const std::vector<Point>& qp,
 				    const Elem* e);
 
+  /**
+   * When the shape functions do not depend on the element geometry
+   * and \p qp are the points of the attached quadrature rule, copies
+   * \p phi and the reference derivatives \p dphidxi etc. from a
+   * cache shared by all \p FE<Dim,T> objects, filling the cache
+   * entry first if necessary.  Returns \p false if the tables can
+   * not be cached, in which case nothing is copied.
+   */
+  bool init_shape_functions_from_cache(const std::vector<Point>& qp,
+				       const Elem* e);
+
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
   /**
@@ -506,6 +506,14 @@ protected:
    */
   std::vector<std::vector<OutputShape> >   phi;
 
+  /**
+   * Set when \p phi was copied from cached reference element tables
+   * which do not depend on the element geometry, so that
+   * \p compute_shape_functions() need not recompute it for each
+   * element.
+   */
+  bool phi_from_cache;
+
   /**
    * Shape function derivative values.
    */
@@ -687,6 +695,7 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   FEAbstract(d,fet),
   _fe_trans( FETransformationBase<OutputType>::build(fet) ),
   phi(),
+  phi_from_cache(false),
   dphi(),
   curl_phi(),
   div_phi(),
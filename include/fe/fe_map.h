@@ -59,7 +59,10 @@ class Elem;
      * Compute the jacobian and some other additional
      * data fields. Takes the integration weights
      * as input, along with a pointer to the element.
-     * The element is assumed to have a constant Jacobian
+     * The element is assumed to have a constant Jacobian,
+     * which is computed by \p compute_affine_maps() for
+     * linear elements and at the first quadrature point
+     * otherwise.
      */
     virtual void compute_affine_map( const unsigned int dim,
 				     const std::vector<Real>& qw,
@@ -73,6 +76,62 @@ class Elem;
     virtual void compute_map( const unsigned int dim,
 			      const std::vector<Real>& qw,
 			      const Elem* elem );
+
+    /**
+     * The constant map data of a batch of affine elements, stored
+     * as one array per quantity (structure of arrays) rather than
+     * one object per element, so that the batched kernel in
+     * \p compute_affine_maps() can be vectorized by the compiler.
+     * Entry \p i of every array belongs to \p elems[i].
+     */
+    struct AffineMapBatch
+    {
+      /**
+       * The elements whose maps were computed.
+       */
+      std::vector<const Elem*> elems;
+
+      /**
+       * Elements in the input which were not handled because they
+       * are not affine Edge2, Tri3, Quad4, Tet4 or Hex8 elements
+       * of the requested dimension; use \p compute_map() for these.
+       */
+      std::vector<const Elem*> other_elems;
+
+      /**
+       * The columns of the Jacobian, e.g. \p dxdxi = dx/dxi.
+       */
+      std::vector<Real> dxdxi,   dydxi,   dzdxi;
+      std::vector<Real> dxdeta,  dydeta,  dzdeta;
+      std::vector<Real> dxdzeta, dydzeta, dzdzeta;
+
+      /**
+       * The Jacobian determinant.  The \p JxW value at a quadrature
+       * point is \p jac times the reference quadrature weight.
+       */
+      std::vector<Real> jac;
+
+      /**
+       * The inverse map derivatives, e.g. \p dxidx = dxi/dx.
+       */
+      std::vector<Real> dxidx,   dxidy,   dxidz;
+      std::vector<Real> detadx,  detady,  detadz;
+      std::vector<Real> dzetadx, dzetady, dzetadz;
+    };
+
+    /**
+     * Computes the constant Jacobian, its determinant and the inverse
+     * map derivatives of every affine linear element of dimension
+     * \p dim in [\p begin, \p end) in one pass, without building
+     * per-element \p FE objects.  This is meant for matrix-free
+     * operators and other kernels which process many elements at a
+     * time; \p ConstElemRange::begin() and \p end() may be passed
+     * directly.
+     */
+    static void compute_affine_maps( const unsigned int dim,
+				     std::vector<const Elem*>::const_iterator begin,
+				     std::vector<const Elem*>::const_iterator end,
+				     AffineMapBatch& batch );
     
     /**
      * Same as compute_map, but for a side.  Useful for boundary integration.
@@ -730,6 +789,14 @@ class Elem;
 
 
   private:
+
+    /**
+     * Scratch space for the single element batches which
+     * \p compute_affine_map() passes to \p compute_affine_maps(),
+     * kept between calls to reuse its storage.
+     */
+    std::vector<const Elem*> _affine_elems;
+    AffineMapBatch           _affine_batch;
     
   };
   
@@ -164,6 +164,20 @@ public:
     return *this;
   }
 
+  /**
+   * Resets the \p StoredRange to contain a copy of the objects in
+   * \p objs.  This allows a subset of a range, e.g. one color of an
+   * element coloring, to be executed on its own.  Returns a reference
+   * to itself for convenience.
+   */
+  StoredRange<iterator_type, object_type> &
+  reset (const std::vector<object_type> &objs)
+  {
+    _objs = objs;
+
+    return this->reset();
+  }
+
   /**
    * Resets the range to the last specified range.  This method only exists
    * for efficiency -- it is more efficient to set the range to its previous
@@ -29,6 +29,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <map>
 #include <vector>
 
 namespace libMesh
@@ -40,6 +41,10 @@ template <typename T> class DenseVector;
 class EquationSystems;
 template <typename T> class NumericVector;
 class DofMap;
+class Elem;
+class FEType;
+template <typename OutputType> class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
 class PointLocatorBase;
 
 
@@ -150,6 +155,21 @@ public:
 		   const Real time,
 		   DenseVector<Number>& output);
 
+  /**
+   * Computes values at each of the coordinates in \p points and for
+   * time \p time.  On return \p output[i] holds the values at
+   * \p points[i], or the out-of-mesh value if that point was not found.
+   *
+   * The points are located in a space-filling-curve order and grouped
+   * by containing element, so that the inverse map, shape functions
+   * and dof indices are computed once per element and FE type rather
+   * than once per point; the elements are then evaluated in parallel.
+   * Prefer this to repeated single-point calls for large point sets.
+   */
+  void operator() (const std::vector<Point>& points,
+		   const Real time,
+		   std::vector<DenseVector<Number> >& output);
+
   /**
    * Computes gradients at coordinate \p p and for time \p time, which
    * defaults to zero.
@@ -204,6 +224,28 @@ public:
 
 protected:
 
+  /**
+   * Returns the element containing \p p on which our vector can be
+   * evaluated: a local element unless the vector is serialized.
+   * Returns \p NULL if there is none.
+   */
+  const Elem* find_element (const Point& p) const;
+
+  /**
+   * Evaluates all variables at the \p physical_points, all of which
+   * must lie in \p element, writing the values at point \p i to
+   * \p *output[i].  FE objects are taken from (and added to)
+   * \p fe_cache, which the caller owns.
+   */
+  void evaluate_on_element (const Elem* element,
+                            const std::vector<Point>& physical_points,
+                            std::map<FEType, FEBase*>& fe_cache,
+                            std::vector<DenseVector<Number>*>& output) const;
+
+  /**
+   * Threaded functor for the batched evaluation.
+   */
+  class BatchEvaluation;
 
   /**
    * The equation systems handler, from which
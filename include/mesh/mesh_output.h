@@ -100,6 +100,21 @@ class MeshOutput
 				 const std::vector<std::string>&)
   { libmesh_error(); }
 
+  /**
+   * This method implements writing a mesh with nodal data to a
+   * specified file, where each processor provides values only for
+   * the nodes of its own active elements, as built by
+   * \p EquationSystems::build_local_solution_vector().  This is how
+   * \p write_equation_systems() passes data to parallel formats.
+   * The default implementation assembles a global solution vector
+   * and calls \p write_nodal_data(); formats which write each
+   * processor's part of the mesh separately should override it.
+   */
+  virtual void write_local_nodal_data (const std::string&,
+				       const std::vector<Number>& soln,
+				       const std::vector<dof_id_type>& node_ids,
+				       const std::vector<std::string>& names);
+
   /**
    * Return/set the precision to use when writing ASCII files.
    *
@@ -150,6 +165,17 @@ class MeshOutput
 						 std::vector<Number>& soln,
 						 std::vector<std::string>& names,
                                                  const std::set<std::string>* system_names=NULL);
+
+  /**
+   * Like \p _build_variable_names_and_solution_vector(), but only
+   * builds the solution at the nodes of our own active elements, for
+   * \p write_local_nodal_data().
+   */
+  void _build_variable_names_and_local_solution_vector(const EquationSystems& es,
+						       std::vector<Number>& soln,
+						       std::vector<dof_id_type>& node_ids,
+						       std::vector<std::string>& names,
+						       const std::set<std::string>* system_names=NULL);
 };
 
 
@@ -239,11 +265,25 @@ void MeshOutput<MT>::write_equation_systems (const std::string& fname,
   std::vector<Number>      soln;
   std::vector<std::string> names;
 
-  this->_build_variable_names_and_solution_vector(es, soln, names, system_names);
-  //es.build_variable_names  (names);
-  //es.build_solution_vector (soln);
+  // Parallel formats only need values for the nodes each processor
+  // writes, so we avoid building the global solution vector for them
+  if (_is_parallel_format)
+    {
+      std::vector<dof_id_type> node_ids;
+
+      this->_build_variable_names_and_local_solution_vector(es, soln, node_ids,
+                                                             names, system_names);
+
+      this->write_local_nodal_data (fname, soln, node_ids, names);
+    }
+  else
+    {
+      this->_build_variable_names_and_solution_vector(es, soln, names, system_names);
+      //es.build_variable_names  (names);
+      //es.build_solution_vector (soln);
 
-  this->write_nodal_data (fname, soln, names);
+      this->write_nodal_data (fname, soln, names);
+    }
 
   STOP_LOG("write_equation_systems()", "MeshOutput");
 }
@@ -560,6 +560,8 @@ private:
    * Calculates the error on all coarsenable parents.
    * error_per_parent[parent_id] stores this error if parent_id corresponds
    * to a coarsenable parent, and stores -1 otherwise.
+   * If \p error_per_cell is distributed, so is \p error_per_parent,
+   * and it is only valid for the local elements and their parents.
    */
   void create_parent_error_vector (const ErrorVector& error_per_cell,
 				   ErrorVector& error_per_parent,
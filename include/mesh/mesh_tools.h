@@ -34,6 +34,14 @@
 #include <vector>
 #include <set>
 
+#ifdef LIBMESH_HAVE_LIBHILBERT
+// Forward declarations of libHilbert types
+class CFixBitVec;
+namespace Hilbert {
+  struct HilbertIndices;
+}
+#endif
+
 namespace libMesh
 {
 
@@ -187,6 +195,30 @@ namespace MeshTools
   subdomain_bounding_sphere (const MeshBase &mesh,
 			     const subdomain_id_type sid);
 
+#ifdef LIBMESH_HAVE_LIBHILBERT
+  /**
+   * Maps \p p, which lies in \p bbox, to integer coordinates in
+   * \f$ [0,2^{n\_bits}-1]^3 \f$, for computing space filling curve
+   * indices.  \p n_bits may be at most the number of bits in a
+   * \p Hilbert::inttype.  Coordinates in which \p bbox is flat map to
+   * 0.
+   */
+  void hilbert_coords (const Point &p,
+		       const BoundingBox &bbox,
+		       const unsigned int n_bits,
+		       CFixBitVec icoords[3]);
+
+  /**
+   * @returns the index of \p p, which lies in \p bbox, along the
+   * Hilbert curve through the full width integer coordinates of
+   * \p hilbert_coords().  This is the key used to number nodes and
+   * elements in parallel.
+   */
+  Hilbert::HilbertIndices
+  hilbert_index (const Point &p,
+		 const BoundingBox &bbox);
+#endif
+
 
   /**
    * Return a vector of all element types for the mesh.  Implemented
@@ -89,6 +89,16 @@ class Nemesis_IO_Helper;
    */
   void write_nodal_data (const std::string& fname, const std::vector<Number>& soln, const std::vector<std::string>& names);
 
+  /**
+   * Output a nodal solution which is only known at the nodes of each
+   * processor's own active elements.  Each processor writes its own
+   * file, so no global solution vector is needed.
+   */
+  virtual void write_local_nodal_data (const std::string& fname,
+                                       const std::vector<Number>& soln,
+                                       const std::vector<dof_id_type>& node_ids,
+                                       const std::vector<std::string>& names);
+
   /**
    * Set the flag indicationg if we should be verbose.
    */
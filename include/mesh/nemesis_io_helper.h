@@ -296,6 +296,13 @@ public:
    */
   void write_nodal_solution(const std::vector<Number> & values, const std::vector<std::string> names, int timestep);
 
+  /**
+   * Takes a solution vector containing the solution for all variables
+   * at the sorted nodes \p node_ids, which must include every node on
+   * this processor, and outputs it to the files
+   */
+  void write_nodal_solution(const std::vector<Number> & values, const std::vector<dof_id_type> & node_ids, const std::vector<std::string> names, int timestep);
+
   /**
    * Given base_filename, foo.e, constructs the Nemesis filename
    * foo.e.X.Y, where X=n. CPUs and Y=processor ID
@@ -40,6 +40,11 @@ namespace libMesh
  * and currently represents the default Mesh implementation.
  * Most methods for this class are found in MeshBase, and most
  * implementation details are found in UnstructuredMesh.
+ *
+ * When libMesh is configured with \p --enable-slab-allocation, the
+ * nodes and elements referenced by a \p SerialMesh (and their DoF
+ * index buffers) are allocated from the \p SlabPool, so that mesh
+ * objects built in order are also laid out in order in memory.
 */
 
 // ------------------------------------------------------------
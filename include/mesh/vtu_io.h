@@ -0,0 +1,158 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VTU_IO_H
+#define LIBMESH_VTU_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_output.h"
+
+// C++ includes
+#include <set>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+class EquationSystems;
+
+
+
+/**
+ * This class implements writing meshes in the VTK XML unstructured
+ * grid format, without requiring the VTK library.  Each processor
+ * writes the active elements it owns as a separate \p .vtu piece,
+ * and processor 0 writes a \p .pvtu file listing all the pieces.
+ * A file name ending in \p .vtu on a single processor is written
+ * as one \p .vtu file instead.
+ *
+ * Array data is written as appended raw binary, optionally zlib
+ * compressed.  Nodal solutions are built on each processor for its
+ * own nodes only, and \p CONSTANT \p MONOMIAL variables are written
+ * as cell data straight from each system's local solution, so
+ * neither the mesh nor the solution is serialized.
+ */
+
+// ------------------------------------------------------------
+// VTUIO class definition
+class VTUIO : public MeshOutput<MeshBase>
+{
+ public:
+
+  /**
+   * Constructor.  Takes a reference to a constant mesh object.
+   * This constructor will only allow us to write the mesh.
+   */
+  explicit
+  VTUIO (const MeshBase&);
+
+  /**
+   * This method implements writing a mesh to a specified file.
+   */
+  virtual void write (const std::string&);
+
+  /**
+   * This method implements writing a mesh with data to a specified
+   * file, where the nodal and cell data are taken from the
+   * \p EquationSystems object.
+   */
+  virtual void write_equation_systems (const std::string&,
+				       const EquationSystems&,
+				       const std::set<std::string>* system_names=NULL);
+
+  /**
+   * This method implements writing a mesh with nodal data to a
+   * specified file where the nodal data and variable names are provided.
+   */
+  virtual void write_nodal_data (const std::string&,
+				 const std::vector<Number>&,
+				 const std::vector<std::string>&);
+
+  /**
+   * This method implements writing a mesh with nodal data to a
+   * specified file where each processor provides the data for the
+   * nodes of its own active elements.
+   */
+  virtual void write_local_nodal_data (const std::string&,
+				       const std::vector<Number>& soln,
+				       const std::vector<dof_id_type>& node_ids,
+				       const std::vector<std::string>& names);
+
+  /**
+   * Flag indicating whether or not to zlib compress the array data.
+   * Compression is only available if zlib was found by \p configure.
+   */
+  bool & compress ();
+
+ private:
+
+  /**
+   * Writes this processor's piece of the mesh and data to \p fname.
+   */
+  void write_piece (const std::string& fname,
+		    const std::vector<Number>& soln,
+		    const std::vector<dof_id_type>& node_ids,
+		    const std::vector<std::string>& names);
+
+  /**
+   * Writes the \p .pvtu file which lists the pieces \p piece_names.
+   */
+  void write_pvtu (const std::string& fname,
+		   const std::vector<std::string>& piece_names,
+		   const std::vector<std::string>& names);
+
+  /**
+   * Fills \p names with the cell data variables of \p _es, if any.
+   */
+  void cell_data_names (std::vector<std::string>& names) const;
+
+  //---------------------------------------------------------------------------
+  // local data
+
+  /**
+   * Flag to compress the array data.
+   */
+  bool _compress;
+
+  /**
+   * The systems to take cell data from, while we write them.
+   */
+  const EquationSystems* _es;
+  const std::set<std::string>* _system_names;
+};
+
+
+
+// ------------------------------------------------------------
+// VTUIO inline members
+inline
+bool & VTUIO::compress ()
+{
+  return _compress;
+}
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_VTU_IO_H
@@ -0,0 +1,774 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FIXED_DENSE_MATRIX_H
+#define LIBMESH_FIXED_DENSE_MATRIX_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix_base.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/fixed_dense_vector.h"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+
+namespace libMesh
+{
+
+
+
+/**
+ * Defines a dense \p M by \p N matrix whose size is known at compile
+ * time, for use in Finite Element-type computations.  This is the
+ * fixed-size counterpart of \p DenseMatrix: the entries are stored
+ * row-major in the object itself, so an element stiffness matrix for
+ * e.g. a scalar variable on a \p Hex8 (\p M=N=8) can be assembled,
+ * solved and added to a \p SparseMatrix without any heap allocation,
+ * and every loop has a constant trip count the compiler can unroll
+ * and vectorize.
+ *
+ * As with \p DenseMatrix, \p lu_solve() and \p cholesky_solve()
+ * factor the matrix in place, after which it may only be used to
+ * solve with further right-hand sides.
+ */
+template<typename T, unsigned int M, unsigned int N>
+class FixedDenseMatrix : public DenseMatrixBase<T>
+{
+public:
+
+  /**
+   * Constructor.  Creates a matrix of zeros.
+   */
+  FixedDenseMatrix();
+
+  /**
+   * Destructor.  Does nothing.
+   */
+  virtual ~FixedDenseMatrix() {}
+
+  /**
+   * Set every element in the matrix to 0, and forget any previous
+   * decomposition.
+   */
+  virtual void zero();
+
+  /**
+   * @returns the \p (i,j) element of the matrix.
+   */
+  T operator() (const unsigned int i,
+		const unsigned int j) const;
+
+  /**
+   * @returns the \p (i,j) element of the matrix as a writeable reference.
+   */
+  T & operator() (const unsigned int i,
+		  const unsigned int j);
+
+  /**
+   * @returns the \p (i,j) element of the matrix.
+   */
+  virtual T el(const unsigned int i,
+	       const unsigned int j) const { return (*this)(i,j); }
+
+  /**
+   * @returns the \p (i,j) element of the matrix as a writeable reference.
+   */
+  virtual T & el(const unsigned int i,
+		 const unsigned int j)     { return (*this)(i,j); }
+
+  /**
+   * Left multiplies by the \p M by \p M matrix \p M2.
+   */
+  virtual void left_multiply (const DenseMatrixBase<T>& M2);
+
+  /**
+   * Right multiplies by the \p N by \p N matrix \p M3.
+   */
+  virtual void right_multiply (const DenseMatrixBase<T>& M3);
+
+  /**
+   * Sets this matrix to the product \p A \p B.
+   */
+  template <unsigned int P>
+  void multiply (const FixedDenseMatrix<T,M,P>& A,
+		 const FixedDenseMatrix<T,P,N>& B);
+
+  /**
+   * Performs the matrix-vector multiplication,
+   * \p dest := (*this) * \p arg.
+   */
+  void vector_mult (FixedDenseVector<T,M>& dest,
+		    const FixedDenseVector<T,N>& arg) const;
+
+  /**
+   * Performs the matrix-vector multiplication,
+   * \p dest := (*this)^T * \p arg.
+   */
+  void vector_mult_transpose (FixedDenseVector<T,N>& dest,
+			      const FixedDenseVector<T,M>& arg) const;
+
+  /**
+   * Performs the scaled matrix-vector multiplication,
+   * \p dest += \p factor * (*this) * \p arg.
+   */
+  void vector_mult_add (FixedDenseVector<T,M>& dest,
+			const T factor,
+			const FixedDenseVector<T,N>& arg) const;
+
+  /**
+   * Multiplies every element in the matrix by \p factor.
+   */
+  void scale (const T factor);
+
+  /**
+   * Multiplies every element in the matrix by \p factor.
+   */
+  FixedDenseMatrix<T,M,N>& operator*= (const T factor);
+
+  /**
+   * Adds \p mat to this matrix.
+   */
+  FixedDenseMatrix<T,M,N>& operator+= (const FixedDenseMatrix<T,M,N>& mat);
+
+  /**
+   * Adds \p factor times \p mat to this matrix.
+   */
+  void add (const T factor,
+	    const FixedDenseMatrix<T,M,N>& mat);
+
+  /**
+   * Solve the system Ax=b given the input vector b.  Partial pivoting
+   * is performed by default in order to keep the algorithm stable to
+   * the effects of round-off error.  The matrix is overwritten by its
+   * LU factors.
+   */
+  void lu_solve (const FixedDenseVector<T,N>& b,
+		 FixedDenseVector<T,N>& x);
+
+  /**
+   * For symmetric positive definite (SPD) matrices. A Cholesky factorization
+   * of A such that A = L L^T is about twice as fast as a standard LU
+   * factorization.  Therefore you can use this method if you know a-priori
+   * that the matrix is SPD.  If the matrix is not SPD, an error is generated.
+   * The matrix is overwritten by its Cholesky factor.
+   */
+  void cholesky_solve (const FixedDenseVector<T,N>& b,
+		       FixedDenseVector<T,N>& x);
+
+  /**
+   * @returns the determinant of the matrix.  Note that this means
+   * doing an LU decomposition and then computing the product of the
+   * diagonal terms.  Therefore this is a non-const method.
+   */
+  T det();
+
+  /**
+   * Copies the entries into the resizable matrix \p mat, e.g. to
+   * pass them to code which only accepts a \p DenseMatrix.
+   */
+  void get_dense_matrix (DenseMatrix<T>& mat) const;
+
+  /**
+   * Access to the values array.  The entries are stored row-major,
+   * \p (i,j) at position \p i*N+j.
+   */
+  T * get_values() { return _val; }
+
+  /**
+   * Access to the values array.  The entries are stored row-major,
+   * \p (i,j) at position \p i*N+j.
+   */
+  const T * get_values() const { return _val; }
+
+private:
+
+  /**
+   * Form the LU decomposition of the matrix in place.
+   */
+  void _lu_decompose ();
+
+  /**
+   * Solves the system Ax=b through back substitution using the
+   * LU factors stored in the matrix.
+   */
+  void _lu_back_substitute (const FixedDenseVector<T,N>& b,
+			    FixedDenseVector<T,N>& x) const;
+
+  /**
+   * Decomposes a symmetric positive definite matrix into a
+   * product of two lower triangular matrices according to
+   * A = LL^T.
+   */
+  void _cholesky_decompose();
+
+  /**
+   * Solves the system Ax=b through back substitution using the
+   * Cholesky factor stored in the matrix.
+   */
+  void _cholesky_back_substitute (const FixedDenseVector<T,N>& b,
+				  FixedDenseVector<T,N>& x) const;
+
+  /**
+   * The actual data values, stored row-major.
+   */
+  T _val[M*N];
+
+  /**
+   * The decomposition schemes above change the entries of the matrix
+   * A.  It is therefore an error to call A.lu_solve() and subsequently
+   * call A.cholesky_solve() since the result will probably not match
+   * any desired outcome.  This typedef keeps track of which decomposition
+   * has been called for this matrix.
+   */
+  enum DecompositionType {LU=0, CHOLESKY=1, NONE};
+
+  /**
+   * This flag keeps track of which type of decomposition has been
+   * performed on the matrix.
+   */
+  DecompositionType _decomposition_type;
+
+  /**
+   * The pivot rows of the LU decomposition.
+   */
+  unsigned int _pivots[M];
+};
+
+
+
+// ------------------------------------------------------------
+// FixedDenseMatrix member functions
+template<typename T, unsigned int M, unsigned int N>
+inline
+FixedDenseMatrix<T,M,N>::FixedDenseMatrix()
+  : DenseMatrixBase<T>(M,N)
+{
+  this->zero();
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::zero()
+{
+  _decomposition_type = NONE;
+
+  for (unsigned int i=0; i != M*N; i++)
+    _val[i] = 0.;
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+T FixedDenseMatrix<T,M,N>::operator () (const unsigned int i,
+					const unsigned int j) const
+{
+  libmesh_assert_less (i, M);
+  libmesh_assert_less (j, N);
+
+  return _val[i*N + j];
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+T & FixedDenseMatrix<T,M,N>::operator () (const unsigned int i,
+					  const unsigned int j)
+{
+  libmesh_assert_less (i, M);
+  libmesh_assert_less (j, N);
+
+  return _val[i*N + j];
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::left_multiply (const DenseMatrixBase<T>& M2)
+{
+  libmesh_assert_equal_to (M2.m(), M);
+  libmesh_assert_equal_to (M2.n(), M);
+
+  // (*this) <- M2 * (*this), using a copy of (*this) on the stack
+  T tmp[M*N];
+  std::copy (_val, _val + M*N, tmp);
+
+  for (unsigned int i=0; i != M; i++)
+    for (unsigned int j=0; j != N; j++)
+      {
+	T val = 0.;
+	for (unsigned int k=0; k != M; k++)
+	  val += M2.el(i,k) * tmp[k*N + j];
+	_val[i*N + j] = val;
+      }
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::right_multiply (const DenseMatrixBase<T>& M3)
+{
+  libmesh_assert_equal_to (M3.m(), N);
+  libmesh_assert_equal_to (M3.n(), N);
+
+  // (*this) <- (*this) * M3, one row at a time
+  T row[N];
+
+  for (unsigned int i=0; i != M; i++)
+    {
+      std::copy (_val + i*N, _val + (i+1)*N, row);
+
+      for (unsigned int j=0; j != N; j++)
+	{
+	  T val = 0.;
+	  for (unsigned int k=0; k != N; k++)
+	    val += row[k] * M3.el(k,j);
+	  _val[i*N + j] = val;
+	}
+    }
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+template<unsigned int P>
+inline
+void FixedDenseMatrix<T,M,N>::multiply (const FixedDenseMatrix<T,M,P>& A,
+					const FixedDenseMatrix<T,P,N>& B)
+{
+  libmesh_assert_not_equal_to (static_cast<const void*>(&A),
+			       static_cast<const void*>(this));
+  libmesh_assert_not_equal_to (static_cast<const void*>(&B),
+			       static_cast<const void*>(this));
+
+  const T* a = A.get_values();
+  const T* b = B.get_values();
+
+  // Loop in i-k-j order so the innermost loop runs along rows
+  // of both B and the result.
+  for (unsigned int i=0; i != M; i++)
+    {
+      T* c = _val + i*N;
+
+      for (unsigned int j=0; j != N; j++)
+	c[j] = 0.;
+
+      for (unsigned int k=0; k != P; k++)
+	{
+	  const T a_ik = a[i*P + k];
+	  for (unsigned int j=0; j != N; j++)
+	    c[j] += a_ik * b[k*N + j];
+	}
+    }
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::vector_mult (FixedDenseVector<T,M>& dest,
+					   const FixedDenseVector<T,N>& arg) const
+{
+  for (unsigned int i=0; i != M; i++)
+    {
+      T val = 0.;
+      for (unsigned int j=0; j != N; j++)
+	val += _val[i*N + j] * arg(j);
+      dest(i) = val;
+    }
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::vector_mult_transpose (FixedDenseVector<T,N>& dest,
+						     const FixedDenseVector<T,M>& arg) const
+{
+  dest.zero();
+
+  for (unsigned int i=0; i != M; i++)
+    {
+      const T arg_i = arg(i);
+      for (unsigned int j=0; j != N; j++)
+	dest(j) += _val[i*N + j] * arg_i;
+    }
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::vector_mult_add (FixedDenseVector<T,M>& dest,
+					       const T factor,
+					       const FixedDenseVector<T,N>& arg) const
+{
+  for (unsigned int i=0; i != M; i++)
+    {
+      T val = 0.;
+      for (unsigned int j=0; j != N; j++)
+	val += _val[i*N + j] * arg(j);
+      dest(i) += factor * val;
+    }
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::scale (const T factor)
+{
+  for (unsigned int i=0; i != M*N; i++)
+    _val[i] *= factor;
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+FixedDenseMatrix<T,M,N>& FixedDenseMatrix<T,M,N>::operator*= (const T factor)
+{
+  this->scale(factor);
+  return *this;
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+FixedDenseMatrix<T,M,N>&
+FixedDenseMatrix<T,M,N>::operator+= (const FixedDenseMatrix<T,M,N>& mat)
+{
+  for (unsigned int i=0; i != M*N; i++)
+    _val[i] += mat._val[i];
+
+  return *this;
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::add (const T factor,
+				   const FixedDenseMatrix<T,M,N>& mat)
+{
+  for (unsigned int i=0; i != M*N; i++)
+    _val[i] += factor * mat._val[i];
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::lu_solve (const FixedDenseVector<T,N>& b,
+					FixedDenseVector<T,N>& x)
+{
+  switch (_decomposition_type)
+    {
+    case NONE:
+      this->_lu_decompose ();
+      break;
+
+    case LU:
+      // Already factored, just need to call back_substitute.
+      break;
+
+    default:
+      libMesh::err << "Error! This matrix already has a "
+		   << "different decomposition..."
+		   << std::endl;
+      libmesh_error();
+    }
+
+  this->_lu_back_substitute (b, x);
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::_lu_decompose ()
+{
+  // If this function was called, there better not be any
+  // previous decomposition of the matrix.
+  libmesh_assert_equal_to (_decomposition_type, NONE);
+
+  // Only square matrices may be decomposed
+  libmesh_assert_equal_to (M, N);
+
+  // A convenient reference to *this
+  FixedDenseMatrix<T,M,N>& A = *this;
+
+  for (unsigned int i=0; i != M; ++i)
+    {
+      // Find the pivot row by searching down the i'th column
+      _pivots[i] = i;
+
+      // std::abs(complex) must return a Real!
+      Real max = std::abs( A(i,i) );
+      for (unsigned int j=i+1; j<M; ++j)
+	{
+	  Real candidate_max = std::abs( A(j,i) );
+	  if (max < candidate_max)
+	    {
+	      max = candidate_max;
+	      _pivots[i] = j;
+	    }
+	}
+
+      // If the max was found in a different row, interchange rows.
+      if (_pivots[i] != i)
+	std::swap_ranges (_val + i*N, _val + (i+1)*N, _val + _pivots[i]*N);
+
+      // If the max abs entry found is zero, the matrix is singular
+      if (A(i,i) == libMesh::zero)
+	{
+	  libMesh::out << "Matrix A is singular!" << std::endl;
+	  libmesh_error();
+	}
+
+      // Scale upper triangle entries of row i by the diagonal entry
+      // Note: don't scale the diagonal entry itself!
+      const T diag_inv = 1. / A(i,i);
+      for (unsigned int j=i+1; j<N; ++j)
+	A(i,j) *= diag_inv;
+
+      // Update the remaining sub-matrix A[i+1:m][i+1:m]
+      // by subtracting off (the diagonal-scaled)
+      // upper-triangular part of row i, scaled by the
+      // i'th column entry of each row.
+      for (unsigned int row=i+1; row<M; ++row)
+	{
+	  const T a_ri = A(row,i);
+	  for (unsigned int col=i+1; col<N; ++col)
+	    A(row,col) -= a_ri * A(i,col);
+	}
+    }
+
+  // Set the flag for LU decomposition
+  _decomposition_type = LU;
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::_lu_back_substitute (const FixedDenseVector<T,N>& b,
+						   FixedDenseVector<T,N>& x) const
+{
+  // A convenient reference to *this
+  const FixedDenseMatrix<T,M,N>& A = *this;
+
+  // Temporary vector storage.  We use this instead of
+  // modifying the RHS.
+  FixedDenseVector<T,N> z = b;
+
+  // Lower-triangular "top to bottom" solve step, taking into account pivots
+  for (unsigned int i=0; i != N; ++i)
+    {
+      // Swap
+      if (_pivots[i] != i)
+	std::swap( z(i), z(_pivots[i]) );
+
+      x(i) = z(i);
+
+      for (unsigned int j=0; j<i; ++j)
+	x(i) -= A(i,j)*x(j);
+
+      x(i) /= A(i,i);
+    }
+
+  // Upper-triangular "bottom to top" solve step
+  for (unsigned int i=N; i != 0; --i)
+    for (unsigned int j=i; j != N; ++j)
+      x(i-1) -= A(i-1,j)*x(j);
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::cholesky_solve (const FixedDenseVector<T,N>& b,
+					      FixedDenseVector<T,N>& x)
+{
+  switch (_decomposition_type)
+    {
+    case NONE:
+      this->_cholesky_decompose ();
+      break;
+
+    case CHOLESKY:
+      // Already factored, just need to call back_substitute.
+      break;
+
+    default:
+      libMesh::err << "Error! This matrix already has a "
+		   << "different decomposition..."
+		   << std::endl;
+      libmesh_error();
+    }
+
+  this->_cholesky_back_substitute (b, x);
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::_cholesky_decompose ()
+{
+  // If we called this function, there better not be any
+  // previous decomposition of the matrix.
+  libmesh_assert_equal_to (_decomposition_type, NONE);
+
+  // Only square matrices may be decomposed
+  libmesh_assert_equal_to (M, N);
+
+  // A convenient reference to *this
+  FixedDenseMatrix<T,M,N>& A = *this;
+
+  for (unsigned int i=0; i != M; ++i)
+    {
+      for (unsigned int j=i; j != N; ++j)
+	{
+	  for (unsigned int k=0; k<i; ++k)
+	    A(i,j) -= A(i,k) * A(j,k);
+
+	  if (i == j)
+	    {
+#ifndef LIBMESH_USE_COMPLEX_NUMBERS
+	      if (A(i,j) <= 0.0)
+		{
+		  libMesh::err << "Error! Can only use Cholesky decomposition "
+			       << "with symmetric positive definite matrices."
+			       << std::endl;
+		  libmesh_error();
+		}
+#endif
+
+	      A(i,i) = std::sqrt(A(i,j));
+	    }
+	  else
+	    A(j,i) = A(i,j) / A(i,i);
+	}
+    }
+
+  // Set the flag for CHOLESKY decomposition
+  _decomposition_type = CHOLESKY;
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::_cholesky_back_substitute (const FixedDenseVector<T,N>& b,
+							 FixedDenseVector<T,N>& x) const
+{
+  // A convenient reference to *this
+  const FixedDenseMatrix<T,M,N>& A = *this;
+
+  // Solve for Ly=b
+  for (unsigned int i=0; i != N; ++i)
+    {
+      T temp = b(i);
+
+      for (unsigned int k=0; k<i; ++k)
+	temp -= A(i,k)*x(k);
+
+      x(i) = temp / A(i,i);
+    }
+
+  // Solve for L^T x = y
+  for (unsigned int i=N; i != 0; --i)
+    {
+      const unsigned int ib = i-1;
+
+      for (unsigned int k=i; k != N; ++k)
+	x(ib) -= A(k,ib) * x(k);
+
+      x(ib) /= A(ib,ib);
+    }
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+T FixedDenseMatrix<T,M,N>::det ()
+{
+  switch (_decomposition_type)
+    {
+    case NONE:
+      // First LU decompose the matrix.
+      this->_lu_decompose ();
+      break;
+
+    case LU:
+      // Already decomposed, don't do anything
+      break;
+
+    default:
+      libMesh::err << "Error! Can't compute the determinant under "
+		   << "the current decomposition."
+		   << std::endl;
+      libmesh_error();
+    }
+
+  // The determinant is the product of the diagonal of U, with
+  // a sign change for each row interchange.
+  T determinant = 1.;
+  unsigned int n_interchanges = 0;
+
+  for (unsigned int i=0; i != M; i++)
+    {
+      if (_pivots[i] != i)
+	n_interchanges++;
+
+      determinant *= (*this)(i,i);
+    }
+
+  // Compute sign of determinant, depends on number of row interchanges!
+  // The sign should be (-1)^{n}, where n is the number of interchanges.
+  Real sign = n_interchanges % 2 == 0 ? 1. : -1.;
+
+  return sign*determinant;
+}
+
+
+
+template<typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::get_dense_matrix (DenseMatrix<T>& mat) const
+{
+  mat.resize(M,N);
+
+  std::copy (_val, _val + M*N, mat.get_values().begin());
+}
+
+
+} // namespace libMesh
+
+#endif // LIBMESH_FIXED_DENSE_MATRIX_H
@@ -0,0 +1,243 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FIXED_DENSE_VECTOR_H
+#define LIBMESH_FIXED_DENSE_VECTOR_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_vector_base.h"
+#include "libmesh/dense_vector.h"
+
+namespace libMesh
+{
+
+
+
+/**
+ * Defines a dense vector whose size \p N is known at compile time,
+ * for use in Finite Element-type computations.  The entries are
+ * stored in the object itself rather than on the heap, and loops
+ * over them have constant trip counts, so element vectors for
+ * elements with a known number of degrees of freedom (e.g. \p N=8
+ * for a scalar variable on a \p Hex8) can be built without any
+ * memory allocation.
+ */
+template<typename T, unsigned int N>
+class FixedDenseVector : public DenseVectorBase<T>
+{
+public:
+
+  /**
+   * Constructor.  Creates a vector of zeros.
+   */
+  FixedDenseVector() { this->zero(); }
+
+  /**
+   * Destructor.  Does nothing.
+   */
+  ~FixedDenseVector() {}
+
+  /**
+   * @returns the size of the vector, \p N.
+   */
+  virtual unsigned int size() const { return N; }
+
+  /**
+   * Set every element in the vector to 0.
+   */
+  virtual void zero();
+
+  /**
+   * @returns the \p (i) element of the vector.
+   */
+  T operator() (const unsigned int i) const;
+
+  /**
+   * @returns the \p (i) element of the vector as a writeable reference.
+   */
+  T & operator() (const unsigned int i);
+
+  /**
+   * @returns the \p (i) element of the vector.
+   */
+  virtual T el(const unsigned int i) const { return (*this)(i); }
+
+  /**
+   * @returns the \p (i) element of the vector as a writeable reference.
+   */
+  virtual T & el(const unsigned int i)     { return (*this)(i); }
+
+  /**
+   * Multiplies every element in the vector by \p factor.
+   */
+  void scale (const T factor);
+
+  /**
+   * Multiplies every element in the vector by \p factor.
+   */
+  FixedDenseVector<T,N>& operator*= (const T factor);
+
+  /**
+   * Adds \p vec to this vector.
+   */
+  FixedDenseVector<T,N>& operator+= (const FixedDenseVector<T,N>& vec);
+
+  /**
+   * Adds \p factor times \p vec to this vector.
+   */
+  void add (const T factor,
+	    const FixedDenseVector<T,N>& vec);
+
+  /**
+   * Evaluate dot product with \p vec.
+   */
+  T dot (const FixedDenseVector<T,N>& vec) const;
+
+  /**
+   * Copies the entries into the resizable vector \p vec.
+   */
+  void get_dense_vector (DenseVector<T>& vec) const;
+
+  /**
+   * Access to the values array.  The \p N entries are contiguous.
+   */
+  T * get_values() { return _val; }
+
+  /**
+   * Access to the values array.  The \p N entries are contiguous.
+   */
+  const T * get_values() const { return _val; }
+
+private:
+
+  /**
+   * The actual data values.
+   */
+  T _val[N];
+};
+
+
+
+// ------------------------------------------------------------
+// FixedDenseVector member functions
+template<typename T, unsigned int N>
+inline
+void FixedDenseVector<T,N>::zero()
+{
+  for (unsigned int i=0; i != N; i++)
+    _val[i] = 0.;
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+T FixedDenseVector<T,N>::operator () (const unsigned int i) const
+{
+  libmesh_assert_less (i, N);
+
+  return _val[i];
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+T & FixedDenseVector<T,N>::operator () (const unsigned int i)
+{
+  libmesh_assert_less (i, N);
+
+  return _val[i];
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+void FixedDenseVector<T,N>::scale (const T factor)
+{
+  for (unsigned int i=0; i != N; i++)
+    _val[i] *= factor;
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+FixedDenseVector<T,N>& FixedDenseVector<T,N>::operator*= (const T factor)
+{
+  this->scale(factor);
+  return *this;
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+FixedDenseVector<T,N>&
+FixedDenseVector<T,N>::operator+= (const FixedDenseVector<T,N>& vec)
+{
+  for (unsigned int i=0; i != N; i++)
+    _val[i] += vec._val[i];
+
+  return *this;
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+void FixedDenseVector<T,N>::add (const T factor,
+				 const FixedDenseVector<T,N>& vec)
+{
+  for (unsigned int i=0; i != N; i++)
+    _val[i] += factor*vec._val[i];
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+T FixedDenseVector<T,N>::dot (const FixedDenseVector<T,N>& vec) const
+{
+  T val = 0.;
+
+  for (unsigned int i=0; i != N; i++)
+    val += _val[i]*vec._val[i];
+
+  return val;
+}
+
+
+
+template<typename T, unsigned int N>
+inline
+void FixedDenseVector<T,N>::get_dense_vector (DenseVector<T>& vec) const
+{
+  vec.resize(N);
+
+  for (unsigned int i=0; i != N; i++)
+    vec(i) = _val[i];
+}
+
+
+} // namespace libMesh
+
+#endif // LIBMESH_FIXED_DENSE_VECTOR_H
@@ -201,6 +201,12 @@ public:
   void add_matrix (const DenseMatrix<T> &dm,
 		   const std::vector<numeric_index_type> &dof_indices);
 
+  /**
+   * The fixed-size \p add_matrix() overloads of \p SparseMatrix,
+   * which would otherwise be hidden by the ones above.
+   */
+  using SparseMatrix<T>::add_matrix;
+
   /**
    * Add a Sparse matrix \p X, scaled with \p a, to \p this,
    * stores the result in \p this: \f$\texttt{this} += a*X \f$.
@@ -235,6 +235,12 @@ public:
   void add_matrix (const DenseMatrix<T> &dm,
 		   const std::vector<numeric_index_type> &dof_indices);
 
+  /**
+   * The fixed-size \p add_matrix() overloads of \p SparseMatrix,
+   * which would otherwise be hidden by the ones above.
+   */
+  using SparseMatrix<T>::add_matrix;
+
   /**
    * Add a Sparse matrix \p X, scaled with \p a, to \p this,
    * stores the result in \p this:
@@ -347,6 +353,16 @@ protected:
 			      const std::vector<numeric_index_type>& cols,
 			      const bool reuse_submatrix) const;
 
+  /**
+   * Adds the row-major \p m by \p n block \p values with a single
+   * call to MatSetValues().
+   */
+  virtual void _add_matrix (const numeric_index_type m,
+			    const numeric_index_type n,
+			    const T *values,
+			    const numeric_index_type *rows,
+			    const numeric_index_type *cols);
+
 private:
 
   /**
@@ -39,6 +39,7 @@ namespace libMesh
 // forward declarations
 template <typename T> class SparseMatrix;
 template <typename T> class DenseMatrix;
+template <typename T, unsigned int M, unsigned int N> class FixedDenseMatrix;
 class DofMap;
 namespace SparsityPattern { class Graph; }
 template <typename T> class NumericVector;
@@ -232,6 +233,28 @@ public:
   virtual void add_matrix (const DenseMatrix<T> &dm,
 			   const std::vector<numeric_index_type> &dof_indices) = 0;
 
+  /**
+   * Add the fixed-size element matrix \p dm to the Sparse matrix.
+   * The \p rows and \p cols arrays must hold \p M and \p N
+   * indices respectively.
+   */
+  template <unsigned int M, unsigned int N>
+  void add_matrix (const FixedDenseMatrix<T,M,N> &dm,
+		   const numeric_index_type *rows,
+		   const numeric_index_type *cols)
+  { this->_add_matrix (M, N, dm.get_values(), rows, cols); }
+
+  /**
+   * Same, but assumes the row and column maps are the same.
+   */
+  template <unsigned int N>
+  void add_matrix (const FixedDenseMatrix<T,N,N> &dm,
+		   const std::vector<numeric_index_type> &dof_indices)
+  {
+    libmesh_assert_equal_to (dof_indices.size(), N);
+    this->_add_matrix (N, N, dm.get_values(), &dof_indices[0], &dof_indices[0]);
+  }
+
   /**
    * Add a Sparse matrix \p _X, scaled with \p _a, to \p this,
    * stores the result in \p this:
@@ -390,6 +413,19 @@ public:
 
 protected:
 
+  /**
+   * Protected implementation of adding the row-major \p m by \p n
+   * array \p values to the matrix, for the fixed-size \p add_matrix()
+   * methods.  The base class version adds one entry at a time;
+   * derived classes should override it to insert the whole block at
+   * once.
+   */
+  virtual void _add_matrix (const numeric_index_type m,
+			    const numeric_index_type n,
+			    const T *values,
+			    const numeric_index_type *rows,
+			    const numeric_index_type *cols);
+
   /**
    * Protected implementation of the create_submatrix and reinit_submatrix
    * routines.  Note that this function must be redefined in derived classes
@@ -208,6 +208,12 @@ public:
   void add_matrix (const DenseMatrix<T> &dm,
 		   const std::vector<numeric_index_type> &dof_indices);
 
+  /**
+   * The fixed-size \p add_matrix() overloads of \p SparseMatrix,
+   * which would otherwise be hidden by the ones above.
+   */
+  using SparseMatrix<T>::add_matrix;
+
   /**
    * Add a Sparse matrix \p X, scaled with \p a, to \p this,
    * stores the result in \p this:
@@ -300,6 +306,17 @@ public:
 
   const Epetra_FECrsMatrix * mat () const { libmesh_assert(_mat); return _mat; }
 
+protected:
+
+  /**
+   * Adds the row-major \p m by \p n block \p values with a single
+   * call to SumIntoGlobalValues().
+   */
+  virtual void _add_matrix (const numeric_index_type m,
+			    const numeric_index_type n,
+			    const T *values,
+			    const numeric_index_type *rows,
+			    const numeric_index_type *cols);
 
 private:
 
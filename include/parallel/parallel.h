@@ -667,6 +667,22 @@ namespace Parallel
     template <typename T>
     void sum(T &r) const;
 
+    /**
+     * Nonblocking versions of min(), max() and sum().  The reduction
+     * is started and \p req is set to complete it; \p r must not be
+     * read or modified until \p req has been waited on.  Without
+     * MPI-3 nonblocking collectives these fall back to the blocking
+     * reductions and \p req is left untouched.
+     */
+    template <typename T>
+    void min(T &r, Request &req) const;
+
+    template <typename T>
+    void max(T &r, Request &req) const;
+
+    template <typename T>
+    void sum(T &r, Request &req) const;
+
     /**
      * Take a container of local variables on each processor, and
      * collect their union over all processors, replacing the set on
@@ -682,6 +698,28 @@ namespace Parallel
     template <typename T>
     void set_union(T &data) const;
 
+    /**
+     * Sparse data exchange.  Sends each nonempty vector \p send_data[p]
+     * to processor p, and replaces \p recv_data with the vectors sent
+     * to this processor, keyed by the processor which sent them.
+     * Processors need not know in advance which others will send to
+     * them.
+     *
+     * With MPI-3 this uses the nonblocking consensus ("NBX") algorithm
+     * of synchronous sends followed by a nonblocking barrier, then
+     * one more barrier so that a later exchange can't be mistaken for
+     * this one; no step scales with size().  Otherwise a single
+     * alltoall of message flags precedes the receives.
+     *
+     * Consecutive exchanges may use the same \p tag, but no other
+     * messages with \p tag may be in flight on this communicator
+     * meanwhile; get_unique_tag() is recommended.
+     */
+    template <typename T>
+    void sparse_exchange(const std::map<unsigned int, std::vector<T> > &send_data,
+                         std::map<unsigned int, std::vector<T> > &recv_data,
+                         const MessageTag &tag=no_tag) const;
+
     /**
      * Blocking message probe.  Allows information about a message to be
      * examined before the message is actually received.
@@ -30,6 +30,7 @@
 // Local includes
 #include <vector>
 #include <iterator>
+#include <utility>
 
 namespace libMesh
 {
@@ -95,6 +96,30 @@ private:
 
 
 
+  /**
+   * Returns the value with (0-based) rank \p k in the global sorted
+   * order of the locally sorted vectors \p sorted_values on all
+   * processors.  Rather than gathering all the values, a
+   * \p Histogram of the window of values which still contains the
+   * k'th one is built repeatedly, and the window is shrunk to the
+   * single bin in which it falls, until it is small enough to gather.
+   * Must be called on all processors at once.
+   */
+  double parallel_select (const std::vector<double>& sorted_values,
+                          dof_id_type k);
+
+  /**
+   * Returns the pair with rank \p k in the global lexicographic
+   * order of the locally sorted vectors \p sorted_pairs.  The first
+   * entry is selected as above; ties are then broken by selecting
+   * among the second entries of the pairs which share it.
+   */
+  std::pair<double, double>
+  parallel_select (const std::vector<std::pair<double, double> >& sorted_pairs,
+                   dof_id_type k);
+
+
+
 
 //--------------------------------------------------------------------------
 template <typename KeyType>
@@ -1786,6 +1786,158 @@ inline void Communicator::sum(std::vector<std::complex<T> > &r) const
 }
 
 
+// The nonblocking reductions reduce in place, so there is no
+// temporary buffer which would have to outlive the call.
+template <typename T>
+inline void Communicator::min(T &r, Request &req) const
+{
+#if MPI_VERSION > 2
+  if (this->size() > 1)
+    {
+      START_LOG("min(nonblocking)", "Parallel");
+
+      MPI_Iallreduce (MPI_IN_PLACE,
+                      &r,
+                      1,
+                      StandardType<T>(&r),
+                      MPI_MIN,
+                      this->get(),
+                      req.get());
+
+      STOP_LOG("min(nonblocking)", "Parallel");
+    }
+#else
+  this->min(r);
+#endif
+}
+
+
+template <typename T>
+inline void Communicator::min(std::vector<T> &r, Request &req) const
+{
+#if MPI_VERSION > 2
+  if (this->size() > 1 && !r.empty())
+    {
+      START_LOG("min(nonblocking)", "Parallel");
+
+      libmesh_assert(this->verify(r.size()));
+
+      MPI_Iallreduce (MPI_IN_PLACE,
+                      &r[0],
+                      libmesh_cast_int<int>(r.size()),
+                      StandardType<T>(&r[0]),
+                      MPI_MIN,
+                      this->get(),
+                      req.get());
+
+      STOP_LOG("min(nonblocking)", "Parallel");
+    }
+#else
+  this->min(r);
+#endif
+}
+
+
+template <typename T>
+inline void Communicator::max(T &r, Request &req) const
+{
+#if MPI_VERSION > 2
+  if (this->size() > 1)
+    {
+      START_LOG("max(nonblocking)", "Parallel");
+
+      MPI_Iallreduce (MPI_IN_PLACE,
+                      &r,
+                      1,
+                      StandardType<T>(&r),
+                      MPI_MAX,
+                      this->get(),
+                      req.get());
+
+      STOP_LOG("max(nonblocking)", "Parallel");
+    }
+#else
+  this->max(r);
+#endif
+}
+
+
+template <typename T>
+inline void Communicator::max(std::vector<T> &r, Request &req) const
+{
+#if MPI_VERSION > 2
+  if (this->size() > 1 && !r.empty())
+    {
+      START_LOG("max(nonblocking)", "Parallel");
+
+      libmesh_assert(this->verify(r.size()));
+
+      MPI_Iallreduce (MPI_IN_PLACE,
+                      &r[0],
+                      libmesh_cast_int<int>(r.size()),
+                      StandardType<T>(&r[0]),
+                      MPI_MAX,
+                      this->get(),
+                      req.get());
+
+      STOP_LOG("max(nonblocking)", "Parallel");
+    }
+#else
+  this->max(r);
+#endif
+}
+
+
+template <typename T>
+inline void Communicator::sum(T &r, Request &req) const
+{
+#if MPI_VERSION > 2
+  if (this->size() > 1)
+    {
+      START_LOG("sum(nonblocking)", "Parallel");
+
+      MPI_Iallreduce (MPI_IN_PLACE,
+                      &r,
+                      1,
+                      StandardType<T>(&r),
+                      MPI_SUM,
+                      this->get(),
+                      req.get());
+
+      STOP_LOG("sum(nonblocking)", "Parallel");
+    }
+#else
+  this->sum(r);
+#endif
+}
+
+
+template <typename T>
+inline void Communicator::sum(std::vector<T> &r, Request &req) const
+{
+#if MPI_VERSION > 2
+  if (this->size() > 1 && !r.empty())
+    {
+      START_LOG("sum(nonblocking)", "Parallel");
+
+      libmesh_assert(this->verify(r.size()));
+
+      MPI_Iallreduce (MPI_IN_PLACE,
+                      &r[0],
+                      libmesh_cast_int<int>(r.size()),
+                      StandardType<T>(&r[0]),
+                      MPI_SUM,
+                      this->get(),
+                      req.get());
+
+      STOP_LOG("sum(nonblocking)", "Parallel");
+    }
+#else
+  this->sum(r);
+#endif
+}
+
+
 template <typename T>
 inline void Communicator::set_union(std::set<T> &data,
                                     const unsigned int root_id) const
@@ -1830,6 +1982,136 @@ inline void Communicator::set_union(std::map<T1,T2> &data) const
 
 
 
+template <typename T>
+inline void Communicator::sparse_exchange
+  (const std::map<unsigned int, std::vector<T> > &send_data,
+   std::map<unsigned int, std::vector<T> > &recv_data,
+   const MessageTag &tag) const
+{
+  START_LOG("sparse_exchange()", "Parallel");
+
+  recv_data.clear();
+
+  // Any example will do for building derived data types
+  const T example = T();
+  StandardType<T> type(&example);
+
+  // Post synchronous sends, which only complete once the matching
+  // receive has started.  Data for ourselves is just copied.
+  std::vector<request> send_requests;
+  send_requests.reserve(send_data.size());
+
+#if MPI_VERSION <= 2
+  std::vector<unsigned int> will_send_to(this->size(), 0);
+#endif
+
+  typename std::map<unsigned int, std::vector<T> >::const_iterator
+    it = send_data.begin();
+  const typename std::map<unsigned int, std::vector<T> >::const_iterator
+    end = send_data.end();
+
+  for (; it != end; ++it)
+    {
+      const unsigned int dest_processor_id = it->first;
+      const std::vector<T> &buf = it->second;
+
+      libmesh_assert_less (dest_processor_id, this->size());
+
+      if (buf.empty())
+        continue;
+
+      if (dest_processor_id == this->rank())
+        {
+          recv_data[dest_processor_id] = buf;
+          continue;
+        }
+
+      send_requests.push_back(MPI_REQUEST_NULL);
+
+#ifndef NDEBUG
+      // Only catch the return value when asserts are active.
+      const int ierr =
+#endif
+        MPI_Issend (const_cast<T*>(&buf[0]),
+                    libmesh_cast_int<int>(buf.size()),
+                    type,
+                    dest_processor_id,
+                    tag.value(),
+                    this->get(),
+                    &send_requests.back());
+      libmesh_assert (ierr == MPI_SUCCESS);
+
+#if MPI_VERSION <= 2
+      will_send_to[dest_processor_id] = 1;
+#endif
+    }
+
+#if MPI_VERSION > 2
+  // Receive whatever arrives until every processor's sends have been
+  // matched, which the nonblocking barrier tells us once everyone has
+  // entered it.
+  request barrier_request = MPI_REQUEST_NULL;
+  bool entered_barrier = false;
+
+  while (true)
+    {
+      int message_waiting = 0;
+      status stat;
+      MPI_Iprobe (MPI_ANY_SOURCE, tag.value(), this->get(),
+                  &message_waiting, &stat);
+
+      if (message_waiting)
+        {
+          const unsigned int src_processor_id = stat.MPI_SOURCE;
+          libmesh_assert (!recv_data.count(src_processor_id));
+          this->receive (src_processor_id, recv_data[src_processor_id],
+                         type, tag);
+        }
+
+      if (entered_barrier)
+        {
+          int barrier_done = 0;
+          MPI_Test (&barrier_request, &barrier_done, MPI_STATUS_IGNORE);
+          if (barrier_done)
+            break;
+        }
+      else
+        {
+          int sends_done = 0;
+          MPI_Testall (libmesh_cast_int<int>(send_requests.size()),
+                       send_requests.empty() ? NULL : &send_requests[0],
+                       &sends_done, MPI_STATUSES_IGNORE);
+          if (sends_done)
+            {
+              MPI_Ibarrier (this->get(), &barrier_request);
+              entered_barrier = true;
+            }
+        }
+    }
+
+  // A processor which sees the nonblocking barrier complete may
+  // start another exchange on the same tag while others are still
+  // probing for this one, and they would take its messages as
+  // theirs.  Nobody leaves until everybody has stopped probing.
+  this->barrier();
+#else
+  // Without a nonblocking barrier, find out who is sending to us
+  this->alltoall(will_send_to);
+
+  for (unsigned int p=0; p != this->size(); ++p)
+    if (will_send_to[p])
+      this->receive (p, recv_data[p], type, tag);
+
+  if (!send_requests.empty())
+    MPI_Waitall (libmesh_cast_int<int>(send_requests.size()),
+                 &send_requests[0], MPI_STATUSES_IGNORE);
+#endif
+
+  STOP_LOG("sparse_exchange()", "Parallel");
+}
+
+
+
 inline status Communicator::probe (const unsigned int src_processor_id,
                                    const MessageTag &tag) const
 {
@@ -2974,6 +3256,15 @@ inline void Communicator::maxloc
 template <typename T>
 inline void Communicator::sum(T &) const {}
 
+template <typename T>
+inline void Communicator::min(T &, Request &) const {}
+
+template <typename T>
+inline void Communicator::max(T &, Request &) const {}
+
+template <typename T>
+inline void Communicator::sum(T &, Request &) const {}
+
 template <typename T>
 inline void Communicator::set_union(T&) const {}
 
@@ -2981,6 +3272,24 @@ template <typename T>
 inline void Communicator::set_union(T&, const unsigned int root_id) const
 { libmesh_assert_equal_to(root_id, 0); }
 
+template <typename T>
+inline void Communicator::sparse_exchange
+  (const std::map<unsigned int, std::vector<T> > &send_data,
+   std::map<unsigned int, std::vector<T> > &recv_data,
+   const MessageTag &) const
+{
+  recv_data.clear();
+
+  typename std::map<unsigned int, std::vector<T> >::const_iterator
+    it = send_data.begin();
+  for (; it != send_data.end(); ++it)
+    {
+      libmesh_assert_equal_to (it->first, 0);
+      if (!it->second.empty())
+        recv_data[it->first] = it->second;
+    }
+}
+
 /**
  * We do not currently support probes on one processor without MPI.
  */
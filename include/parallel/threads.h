@@ -25,7 +25,6 @@
 
 // Threading building blocks includes
 #ifdef LIBMESH_HAVE_TBB_API
-#  include "libmesh/libmesh_logging.h" // only mess with the perflog if we are really multithreaded
 #  include "tbb/tbb_stddef.h"
 #  include "tbb/blocked_range.h"
 #  include "tbb/parallel_for.h"
@@ -153,23 +152,11 @@ namespace Threads
   {
     BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-    if (libMesh::n_threads() > 1)
-      libMesh::perflog.disable_logging();
-#endif
-
     if (libMesh::n_threads() > 1)
       tbb::parallel_for (range, body, tbb::auto_partitioner());
 
     else
       body(range);
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    if (libMesh::n_threads() > 1 && logging_was_enabled)
-      libMesh::perflog.enable_logging();
-#endif
   }
 
 
@@ -185,23 +172,11 @@ namespace Threads
   {
     BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-    if (libMesh::n_threads() > 1)
-      libMesh::perflog.disable_logging();
-#endif
-
     if (libMesh::n_threads() > 1)
       tbb::parallel_for (range, body, partitioner);
 
     else
       body(range);
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    if (libMesh::n_threads() > 1 && logging_was_enabled)
-      libMesh::perflog.enable_logging();
-#endif
   }
 
 
@@ -217,23 +192,11 @@ namespace Threads
   {
     BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-    if (libMesh::n_threads() > 1)
-      libMesh::perflog.disable_logging();
-#endif
-
     if (libMesh::n_threads() > 1)
       tbb::parallel_reduce (range, body, tbb::auto_partitioner());
 
     else
       body(range);
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    if (libMesh::n_threads() > 1 && logging_was_enabled)
-      libMesh::perflog.enable_logging();
-#endif
   }
 
 
@@ -249,23 +212,11 @@ namespace Threads
   {
     BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-    if (libMesh::n_threads() > 1)
-      libMesh::perflog.disable_logging();
-#endif
-
        if (libMesh::n_threads() > 1)
 	 tbb::parallel_reduce (range, body, partitioner);
 
        else
 	 body(range);
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-    if (libMesh::n_threads() > 1 && logging_was_enabled)
-      libMesh::perflog.enable_logging();
-#endif
   }
 
 
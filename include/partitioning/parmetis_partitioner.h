@@ -60,6 +60,14 @@ class ParmetisPartitioner : public Partitioner
     return cloned_partitioner;
   }
 
+  /**
+   * Attach weights to be used as the ParMETIS vertex weights in
+   * place of the number of nodes of each element.  Only the entries
+   * for active local elements are used, and they are truncated to
+   * integers.
+   */
+  virtual void attach_weights(ErrorVector * weights) { _weights = weights; }
+
 
 protected:
 
@@ -90,6 +90,41 @@ class Partitioner
   void repartition (MeshBase& mesh,
 		    const unsigned int n=libMesh::n_processors());
 
+  /**
+   * Returns the ratio of the largest processor's share of the total
+   * \p costs of the active elements to the average share, or 1 if
+   * all the costs are zero.  \p costs is indexed by element id, and
+   * only the entries for active local elements are read, so costs
+   * measured or estimated on each processor for its own elements may
+   * be passed directly.
+   */
+  static Real load_imbalance (const MeshBase& mesh,
+                              const ErrorVector& costs);
+
+  /**
+   * As above, and also sets \p total_cost to the sum of the \p costs
+   * of all the active elements.
+   */
+  static Real load_imbalance (const MeshBase& mesh,
+                              const ErrorVector& costs,
+                              Real& total_cost);
+
+  /**
+   * If load_imbalance(mesh, costs) exceeds \p max_imbalance,
+   * repartitions the mesh using the element \p costs as partitioning
+   * weights, redistributes the elements of a ParallelMesh, and
+   * returns true.  Otherwise leaves the mesh alone and returns false.
+   *
+   * Costs need only be set for active local elements, as for
+   * load_imbalance().  The weights actually attached are rescaled to
+   * integers no smaller than one, as graph partitioners require.
+   * This partitioner must support attach_weights().  After a
+   * rebalance the EquationSystems on the mesh must be reinit()ed.
+   */
+  bool rebalance (MeshBase& mesh,
+                  const ErrorVector& costs,
+                  const Real max_imbalance = 1.1);
+
   /**
    * This function
    */
@@ -66,6 +66,15 @@ class SFCPartitioner : public Partitioner
    */
   void set_sfc_type (const std::string& sfc_type);
 
+  /**
+   * Attach weights to balance along the curve instead of element
+   * counts.  The weight of each element is looked up by its id, and
+   * only needs to be set for the active elements owned by this
+   * processor, so a distributed \p ErrorVector will do.  Weighted
+   * partitioning requires the Hilbert library.
+   */
+  virtual void attach_weights(ErrorVector * weights) { _weights = weights; }
+
 
 protected:
 
@@ -78,6 +87,16 @@ protected:
 
 private:
 
+  /**
+   * Partition the \p MeshBase into \p n subdomains without
+   * serializing it.  Curve indices are computed with the Hilbert
+   * library and sorted in parallel, and each processor only sends
+   * the indices of the elements it can see to the processors whose
+   * sorted bins contain them.  Used for distributed meshes, for
+   * weighted partitioning, and when the sfcurves library is missing.
+   */
+  void _do_distributed_partition (MeshBase& mesh,
+				  const unsigned int n);
 
   /**
    * The type of space-filling curve to use.  Hilbert by default.
@@ -517,6 +517,17 @@ public:
    */
   bool use_empty_rb_solve_in_greedy;
 
+  /**
+   * A boolean flag to indicate whether the Greedy algorithm computes
+   * the error bounds on the training set with batched reduced solves
+   * (see get_RB_error_bounds()).  This is faster, but only valid if
+   * neither get_RB_error_bound() nor RBEvaluation::rb_solve() has
+   * been overloaded without also overloading get_RB_error_bounds()
+   * or RBEvaluation::rb_solve_batch() to match, so it is off by
+   * default.
+   */
+  bool use_batched_rb_solves_in_greedy;
+
 protected:
 
   /**
@@ -656,6 +667,18 @@ protected:
    */
   virtual Real get_RB_error_bound();
 
+  /**
+   * Computes get_RB_error_bound() for each of the parameters in \p
+   * mus and stores the results in \p error_bounds.  By default this
+   * calls get_RB_error_bound() once per parameter; if
+   * \p use_batched_rb_solves_in_greedy is set the reduced systems are
+   * instead solved together with RBEvaluation::rb_solve_batch(),
+   * bypassing any overloads of get_RB_error_bound() and
+   * RBEvaluation::rb_solve().
+   */
+  virtual void get_RB_error_bounds(const std::vector<RBParameters>& mus,
+                                   std::vector<Real>& error_bounds);
+
   /**
    * Compute the reduced basis matrices for the current basis.
    */
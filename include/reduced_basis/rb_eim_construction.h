@@ -211,6 +211,12 @@ protected:
    */
   virtual Real get_RB_error_bound();
 
+  /**
+   * Overload to compute the best fit errors one parameter at a time.
+   */
+  virtual void get_RB_error_bounds(const std::vector<RBParameters>& mus,
+                                   std::vector<Real>& error_bounds);
+
   /**
    * Function that indicates when to terminate the Greedy
    * basis training. Overload in subclasses to specialize.
@@ -106,6 +106,15 @@ public:
    */
   virtual Real rb_solve(unsigned int N);
 
+  /**
+   * Overridden to compute one EIM approximation per parameter.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters>& mus,
+                              std::vector<Real>& error_bounds,
+                              std::vector<Real>* solution_norms = NULL)
+  { rb_solve_each(N, mus, error_bounds, solution_norms); }
+
   /**
    * Calculate the EIM approximation for the given
    * right-hand side vector \p EIM_rhs. Store the
@@ -110,6 +110,33 @@ public:
    */
   virtual Real rb_solve(unsigned int N);
 
+  /**
+   * Computes the error bounds that rb_solve(N) would return for each
+   * of the parameters in \p mus, and stores them in \p error_bounds.
+   * If \p solution_norms is not NULL, the norms of the corresponding
+   * RB solutions are stored there too.  The reduced systems of the
+   * whole batch are assembled and LU factorized (with partial
+   * pivoting) together, with the parameters interleaved so that the
+   * innermost loops run over the batch.  RB outputs and their error bounds are not computed.
+   * Afterwards the parameters and RB_solution are those of the last
+   * entry of \p mus.
+   *
+   * Subclasses which override rb_solve() should override this too,
+   * e.g. with rb_solve_each().
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters>& mus,
+                              std::vector<Real>& error_bounds,
+                              std::vector<Real>* solution_norms = NULL);
+
+  /**
+   * Implements rb_solve_batch() with one rb_solve() per parameter.
+   */
+  void rb_solve_each(unsigned int N,
+                     const std::vector<RBParameters>& mus,
+                     std::vector<Real>& error_bounds,
+                     std::vector<Real>* solution_norms = NULL);
+
   /**
    * Return the norm of RB_solution.
    */
@@ -90,6 +90,15 @@ public:
    */
   virtual Real rb_solve(unsigned int N);
 
+  /**
+   * Overridden to perform one time-dependent solve per parameter.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters>& mus,
+                              std::vector<Real>& error_bounds,
+                              std::vector<Real>* solution_norms = NULL)
+  { rb_solve_each(N, mus, error_bounds, solution_norms); }
+
   /**
    * Override to return the L2 norm of RB_solution.
    */
@@ -95,6 +95,14 @@ public:
    */
   virtual unsigned int solve () = 0;
 
+  /**
+   * @returns true if this solver needs the system to allocate and
+   * assemble its matrix.  Solvers which apply the jacobian without
+   * storing it may return false, so that the matrix is not
+   * allocated.
+   */
+  virtual bool needs_system_matrix () const { return true; }
+
   /**
    * @returns the number of "outer" (e.g. quasi-Newton) iterations
    * required by the last solve.
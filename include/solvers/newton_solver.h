@@ -137,6 +137,34 @@ public:
    */
   AutoPtr<LinearSolutionMonitor> linear_solution_monitor;
 
+  /**
+   * Attaches a shell matrix, e.g. an \p FEMSystemShellMatrix, which
+   * applies the jacobian in the linear solves instead of the
+   * assembled system matrix.  The system is then only asked for
+   * residuals.  If the shell matrix is attached before the system is
+   * initialized (or reinitialized), the system matrices are never
+   * allocated, and the linear solver may only be preconditioned
+   * using the diagonal of the shell matrix.
+   */
+  void attach_shell_matrix (ShellMatrix<Number>* shell_matrix);
+
+  /**
+   * Detaches a shell matrix.  Same as \p attach_shell_matrix(NULL).
+   */
+  void detach_shell_matrix (void) { attach_shell_matrix(NULL); }
+
+  /**
+   * Returns a pointer to the currently attached shell matrix, if any,
+   * or \p NULL otherwise.
+   */
+  ShellMatrix<Number>* get_shell_matrix(void) { return _shell_matrix; }
+
+  /**
+   * Returns false if a shell matrix is attached, in which case the
+   * system matrix is not needed.
+   */
+  virtual bool needs_system_matrix () const { return !_shell_matrix; }
+
 protected:
 
   /**
@@ -147,6 +175,11 @@ protected:
    */
   AutoPtr<LinearSolver<Number> > linear_solver;
 
+  /**
+   * User supplied shell matrix or \p NULL if no shell matrix is used.
+   */
+  ShellMatrix<Number>* _shell_matrix;
+
   /**
    * This does a line search in the direction opposite linear_solution
    * to try and minimize the residual of newton_iterate.
@@ -320,6 +320,12 @@ protected:
    * the system, so that, e.g., \p assemble() may be used.
    */
   virtual void init_data ();
+
+  /**
+   * Initializes the matrices associated with this system, unless
+   * our solver does not need them.
+   */
+  virtual void init_matrices ();
 };
 
 // --------------------------------------------------------------
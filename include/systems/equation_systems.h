@@ -283,6 +283,22 @@ public:
   void build_solution_vector (std::vector<Number>& soln,
                               const std::set<std::string>* system_names=NULL) const;
 
+  /**
+   * Fill the input vector \p soln with solution values at the nodes
+   * of this processor's active elements, whose sorted ids are
+   * returned in \p node_ids.  The values for node \p node_ids[i]
+   * start at \p soln[i*nv], where \p nv is the number of names
+   * from \p build_variable_names(), and are the same averages
+   * \p build_solution_vector() computes.  Only partition boundary
+   * nodes are communicated, so the memory used on each processor is
+   * proportional to its share of the mesh.
+   * If systems_names!=NULL, only include data from the
+   * specified systems.
+   */
+  void build_local_solution_vector (std::vector<Number>& soln,
+                                    std::vector<dof_id_type>& node_ids,
+                                    const std::set<std::string>* system_names=NULL) const;
+
   /**
    * Retrieve the solution data for CONSTANT MONOMIALs.  If \p names
    * is populated, only the variables corresponding to those names will
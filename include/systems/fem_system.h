@@ -32,6 +32,7 @@ namespace libMesh
 
 // Forward Declarations
 class DiffContext;
+class ErrorVector;
 class FEMContext;
 
 
@@ -93,6 +94,40 @@ public:
    */
   virtual void assembly (bool get_residual, bool get_jacobian);
 
+  /**
+   * Adds to \p dest the product of the jacobian with \p arg.  The
+   * global jacobian is never assembled: each element jacobian is
+   * computed exactly as in \p assembly(), applied to the element's
+   * entries of \p arg, and discarded.  Element loops are threaded
+   * like \p assembly().
+   *
+   * The jacobian is linearized about \p current_local_solution, which
+   * is not updated here, so that a linear solve does not localize the
+   * solution again for every product; call \p update() (or a residual
+   * \p assembly(), which does so) after changing \p solution.
+   */
+  void jacobian_vector_mult_add (NumericVector<Number> &dest,
+                                 const NumericVector<Number> &arg);
+
+  /**
+   * Computes the diagonal of the jacobian into \p dest, again
+   * without assembling the global jacobian.
+   */
+  void jacobian_diagonal (NumericVector<Number> &dest);
+
+  /**
+   * Fills \p costs, indexed by element id, with an a priori estimate
+   * of the cost of assembling each active local element: the number
+   * of element degrees of freedom squared, times the number of
+   * quadrature points needed to integrate products of its shape
+   * functions exactly.  This accounts for p refinement and for
+   * variables of differing order, and needs only the element types
+   * and p levels, so it may be used right after mesh refinement and
+   * before the DofMap has been redistributed.  Entries for other
+   * elements are set to zero.
+   */
+  void estimate_element_costs (ErrorVector &costs) const;
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
@@ -168,6 +203,38 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * If buffered_assembly is true (it is false by default), each
+   * assembly thread stages its element jacobians and residuals in a
+   * private buffer, sums contributions to shared dofs locally, and
+   * only locks the global matrix and vector when that buffer is
+   * flushed, rather than once per element.  This trades some memory
+   * for much less lock contention when assembling with many threads.
+   */
+  bool buffered_assembly;
+
+  /**
+   * If colored_assembly is true (it is false by default), elements
+   * are assembled one color of DofMap::local_elem_colors() at a time,
+   * and since elements of the same color share no degrees of freedom
+   * their contributions are added to the global matrix and vector
+   * without any locking.  This is only safe if the numerical backend
+   * allows concurrent add_matrix() and add_vector() calls on disjoint
+   * entries, which e.g. PETSc with its off-processor stash does not.
+   */
+  bool colored_assembly;
+
+  /**
+   * If element_costs is not NULL (it is NULL by default), assembly()
+   * adds the wall clock time spent on each active local element to
+   * the entry for that element's id, resizing and zeroing the vector
+   * first if it does not have mesh.max_elem_id() entries.  The
+   * measured costs may then be passed to Partitioner::rebalance().
+   * Times accumulate over calls to assembly(), so users should clear()
+   * the vector whenever they want to start measuring afresh.
+   */
+  ErrorVector *element_costs;
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
@@ -0,0 +1,109 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
+#define LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEMSystem;
+
+
+
+/**
+ * A shell matrix which applies the jacobian of an \p FEMSystem,
+ * linearized about the system's current solution, without storing
+ * it.  Every product recomputes the element jacobians on the fly via
+ * \p FEMSystem::jacobian_vector_mult_add(), so memory use is that of
+ * one element matrix per thread rather than of the global sparse
+ * matrix.  This pays off for high order elements, where the assembled
+ * jacobian dominates memory, at the cost of an element loop per
+ * product.
+ *
+ * The system's time solver, element and side physics, constraints and
+ * numerical jacobian settings are all honored exactly as in
+ * \p FEMSystem::assembly().
+ *
+ * To solve with it, attach it to the system's \p NewtonSolver via
+ * \p NewtonSolver::attach_shell_matrix() before the system is
+ * initialized; the global jacobian is then never allocated either.
+ */
+class FEMSystemShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor.  The shell matrix keeps a reference to \p sys, which
+   * must outlive it.
+   */
+  explicit
+  FEMSystemShellMatrix (FEMSystem& sys);
+
+  /**
+   * Destructor.
+   */
+  virtual ~FEMSystemShellMatrix ();
+
+  /**
+   * @returns \p m, the row-dimension of the matrix where the marix is
+   * \f$ M \times N \f$.
+   */
+  virtual numeric_index_type m () const;
+
+  /**
+   * @returns \p n, the column-dimension of the matrix where the marix
+   * is \f$ M \times N \f$.
+   */
+  virtual numeric_index_type n () const;
+
+  /**
+   * Multiplies the matrix with \p arg and stores the result in \p
+   * dest.
+   */
+  virtual void vector_mult (NumericVector<Number>& dest,
+			    const NumericVector<Number>& arg) const;
+
+  /**
+   * Multiplies the matrix with \p arg and adds the result to \p dest.
+   */
+  virtual void vector_mult_add (NumericVector<Number>& dest,
+				const NumericVector<Number>& arg) const;
+
+  /**
+   * Copies the diagonal part of the matrix into \p dest.
+   */
+  virtual void get_diagonal (NumericVector<Number>& dest) const;
+
+private:
+
+  /**
+   * The system whose jacobian we apply.
+   */
+  FEMSystem& _sys;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
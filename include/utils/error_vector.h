@@ -25,6 +25,8 @@
 
 // C++ includes
 #include <cstddef>
+#include <vector>
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 
 namespace libMesh
 {
@@ -47,13 +49,48 @@ class Mesh;
  * the statistics.  Since the error is a positive quantity this class
  * assumes it contains positive data (i.e. min_val >= 0.).
  *
+ * An \p ErrorVector which knows its mesh may also be put in
+ * distributed mode with \p set_distributed().  It then only stores
+ * entries for the elements this processor works with: \p resize()
+ * creates zero entries for the active elements the mesh holds, and
+ * entries for other elements are created when they are first
+ * written.  \p size() is still the nominal length of the vector, and
+ * reading an entry which is not stored gives zero.  Error estimators
+ * combine each processor's contributions by exchanging them only
+ * with the processors which own the elements concerned, and the
+ * statistics are computed from the local entries with global
+ * reductions.
+ *
+ * In either mode \p begin() and \p end() run over the stored
+ * entries, and \p n_stored(), \p stored_id() and \p stored_value()
+ * may be used to loop over them along with their element ids.  The
+ * \p std::vector storage is a private base, so that it cannot be
+ * modified behind the back of distributed mode.
+ *
  * @author Benjamin S. Kirk, 2003.
  */
-class ErrorVector : public StatisticsVector<ErrorVectorReal>
+class ErrorVector : private StatisticsVector<ErrorVectorReal>
 {
 
 public:
 
+  typedef StatisticsVector<ErrorVectorReal>::value_type     value_type;
+  typedef StatisticsVector<ErrorVectorReal>::iterator       iterator;
+  typedef StatisticsVector<ErrorVectorReal>::const_iterator const_iterator;
+
+  /**
+   * Iterators over the stored entries.
+   */
+  using StatisticsVector<ErrorVectorReal>::begin;
+  using StatisticsVector<ErrorVectorReal>::end;
+
+  /**
+   * Statistics which are computed from the virtual functions below.
+   */
+  using StatisticsVector<ErrorVectorReal>::stddev;
+  using StatisticsVector<ErrorVectorReal>::normalize;
+  using StatisticsVector<ErrorVectorReal>::plot_histogram;
+
   /**
    * ErrorVector constructor; sets initial length to \p i.
    *
@@ -62,7 +99,9 @@ public:
    * ErrorVector will assume that all 0.0 error values correspond to inactive
    * elements and all non-zero error values correspond to active elements.
    */
-  ErrorVector(dof_id_type i=0, MeshBase *mesh = NULL) : StatisticsVector<ErrorVectorReal> (i), _mesh(mesh) {}
+  ErrorVector(dof_id_type i=0, MeshBase *mesh = NULL) :
+      StatisticsVector<ErrorVectorReal> (i), _mesh(mesh), _distributed(false),
+      _global_size(0) {}
 
   /**
    * ErrorVector constructor; sets initial length to \p i and initial values to \p val.
@@ -73,13 +112,139 @@ public:
    * elements and all non-zero error values correspond to active elements.
    */
   ErrorVector(dof_id_type i, ErrorVectorReal val) :
-      StatisticsVector<ErrorVectorReal> (i,val) {}
+      StatisticsVector<ErrorVectorReal> (i,val), _mesh(NULL), _distributed(false),
+      _global_size(0) {}
+
+  /**
+   * Returns the entry for element \p i.  In distributed mode the
+   * entry is created if it is not yet stored, which is only safe to
+   * do on one thread at a time.
+   */
+  ErrorVectorReal & operator[] (dof_id_type i);
+
+  /**
+   * Returns the entry for element \p i, or zero if a distributed
+   * vector does not store it.
+   */
+  const ErrorVectorReal & operator[] (dof_id_type i) const;
+
+  /**
+   * Returns the length of the vector, which in distributed mode is
+   * larger than the number of entries stored.
+   */
+  std::size_t size () const
+  { return _distributed ? _global_size : this->n_stored(); }
+
+  /**
+   * Sets the length of the vector to \p n.  In distributed mode
+   * this discards any stored entries and creates zero entries for
+   * the active elements the mesh holds, so that several threads may
+   * then write to those; \p val must be zero.
+   */
+  void resize (std::size_t n, ErrorVectorReal val = 0.);
+
+  /**
+   * Empties the vector.
+   */
+  void clear ();
+
+  /**
+   * Swaps the contents, mesh and mode of this vector with \p other.
+   */
+  void swap (ErrorVector &other);
+
+  /**
+   * Returns the entries of a vector which is not distributed, for
+   * operations such as parallel sums which work on the whole vector.
+   */
+  std::vector<ErrorVectorReal> & get_serial_vector ()
+  { libmesh_assert (!_distributed); return *this; }
+
+  /**
+   * Returns the number of entries actually stored.
+   */
+  std::size_t n_stored () const
+  { return StatisticsVector<ErrorVectorReal>::size(); }
+
+  /**
+   * Returns the element id of stored entry \p s.
+   */
+  dof_id_type stored_id (std::size_t s) const
+  { return _distributed ? _stored_ids[s] : libmesh_cast_int<dof_id_type>(s); }
+
+  /**
+   * Returns the value of stored entry \p s.
+   */
+  ErrorVectorReal stored_value (std::size_t s) const
+  { return StatisticsVector<ErrorVectorReal>::operator[](s); }
+
+  /**
+   * Turns distributed mode on or off, keeping the nonzero entries.
+   * Distributed mode requires the ErrorVector to have been
+   * constructed with a mesh.
+   */
+  void set_distributed (bool distributed = true);
+
+  /**
+   * Returns true if only the entries for local and ghosted elements
+   * are kept up to date.
+   */
+  bool is_distributed () const
+  { return _distributed; }
+
+  /**
+   * Returns the mesh this vector was constructed with, or NULL.
+   */
+  MeshBase * get_mesh () const
+  { return _mesh; }
+
+  /**
+   * Combines the contributions which each processor has made to a
+   * distributed ErrorVector.  The entries for each element are summed
+   * on the processor which owns it, and the results are then copied
+   * to every processor which made a contribution to that element, or
+   * which owns an active neighbor or child of it.
+   *
+   * Negative entries are used to mark elements which should be
+   * skipped; if any processor's contribution to an element is
+   * negative, the smallest such contribution is kept instead of the sum.
+   *
+   * Callers which need to post-process the sums on their owners
+   * before they are copied may call \p sum_contributions() and
+   * \p sync_ghosts() separately instead.
+   */
+  void reduce_distributed ();
+
+  /**
+   * The first half of \p reduce_distributed(): sums each element's
+   * contributions on the processor which owns it.  Entries for
+   * elements owned elsewhere are left unchanged.
+   */
+  void sum_contributions ();
+
+  /**
+   * The second half of \p reduce_distributed(): overwrites the
+   * nonzero entries for elements owned elsewhere, and the entries for
+   * active neighbors and parents of local active elements, with the
+   * values held by their owners.
+   */
+  void sync_ghosts ();
 
   /**
    * Returns the minimum nonzero value in the data set.
    */
   virtual ErrorVectorReal minimum() const;
 
+  /**
+   * Returns the maximum value in the data set.
+   */
+  virtual ErrorVectorReal maximum() const;
+
+  /**
+   * Returns the l2 norm of the data set.
+   */
+  virtual Real l2_norm() const;
+
   /**
    * Returns the mean value of the data set. Ignores
    * zero values.
@@ -129,10 +294,25 @@ public:
    */
   virtual Real variance(const Real mean) const;
 
+  /**
+   * Computes and returns a histogram with n_bins bins for the data
+   * set, ignoring inactive elements.  In distributed mode the
+   * counts are summed over all processors.
+   */
+  virtual void histogram (std::vector<dof_id_type>& bin_members,
+			  unsigned int n_bins=10);
+
+  /**
+   * A const version of the histogram function.
+   */
+  virtual void histogram (std::vector<dof_id_type>& bin_members,
+			  unsigned int n_bins=10) const;
+
   /**
    * Returns a vector of dof_id_types which correspond
    * to the indices of every member of the data set
    * below the cutoff value cut ignoring inactive elements.
+   * In distributed mode only local elements are returned.
    */
   virtual std::vector<dof_id_type> cut_below(Real cut) const;
 
@@ -140,6 +320,7 @@ public:
    * Returns a vector of dof_id_types which correspond
    * to the indices of every member of the data set
    * above the cutoff value cut ignoring inactive elements.
+   * In distributed mode only local elements are returned.
    */
   virtual std::vector<dof_id_type> cut_above(Real cut) const;
 
@@ -162,9 +343,71 @@ protected:
    * elements are active
    */
   MeshBase *_mesh;
+
+  /**
+   * True if only local and ghosted entries are stored
+   */
+  bool _distributed;
+
+private:
+
+  /**
+   * Returns the entry for element \p i of a distributed vector,
+   * creating it if necessary.
+   */
+  ErrorVectorReal & distributed_entry (dof_id_type i);
+
+  /**
+   * The nominal length of a distributed vector
+   */
+  dof_id_type _global_size;
+
+  /**
+   * The element ids of the entries of a distributed vector, in the
+   * order they are stored
+   */
+  std::vector<dof_id_type> _stored_ids;
+
+  /**
+   * The position of each element's entry in a distributed vector
+   */
+  LIBMESH_BEST_UNORDERED_MAP<dof_id_type, dof_id_type> _slots;
 };
 
 
+
+// ------------------------------------------------------------
+// ErrorVector inline methods
+inline
+ErrorVectorReal & ErrorVector::operator[] (dof_id_type i)
+{
+  if (!_distributed)
+    return StatisticsVector<ErrorVectorReal>::operator[](i);
+
+  return this->distributed_entry(i);
+}
+
+
+
+inline
+const ErrorVectorReal & ErrorVector::operator[] (dof_id_type i) const
+{
+  if (!_distributed)
+    return StatisticsVector<ErrorVectorReal>::operator[](i);
+
+  libmesh_assert_less (i, _global_size);
+
+  static const ErrorVectorReal zero = 0.;
+
+  LIBMESH_BEST_UNORDERED_MAP<dof_id_type, dof_id_type>::const_iterator
+    it = _slots.find(i);
+  if (it == _slots.end())
+    return zero;
+
+  return StatisticsVector<ErrorVectorReal>::operator[](it->second);
+}
+
+
 } // namespace libMesh
 
 #endif // LIBMESH_ERROR_VECTOR_H
@@ -21,7 +21,11 @@
 #define LIBMESH_MAPVECTOR_H
 
 // C++ Includes   -----------------------------------
+#include <algorithm>
+#include <cstddef>
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
@@ -31,6 +35,13 @@ namespace libMesh
  * performance characteristics of a std::map with an interface more
  * closely resembling that of a std::vector, for use with ParallelMesh.
  *
+ * Iteration follows the underlying std::map, in increasing index
+ * order, but lookups by index go through an open-addressing hash
+ * table of map iterators, so that \p operator[], \p find() and
+ * \p count() are O(1) rather than O(log n).  Only the methods
+ * redefined here keep that table up to date; other std::map
+ * modifiers must not be called directly.
+ *
  * \author  Roy H. Stogner
  */
 
@@ -40,14 +51,63 @@ class mapvector : public std::map<index_t, Val>
 public:
   typedef std::map<index_t, Val> maptype;
 
+  mapvector () : _n_hashed(0) {}
+
+  mapvector (const mapvector &other) :
+    maptype(other),
+    _n_hashed(0)
+  {
+    this->rehash(other._hash_table.size());
+  }
+
+  mapvector& operator= (const mapvector &other)
+  {
+    maptype::operator=(other);
+    this->rehash(other._hash_table.size());
+    return *this;
+  }
+
   Val& operator[] (const index_t &k)
   {
-    return maptype::operator[](k);
+    typename maptype::iterator it = this->find(k);
+    if (it == maptype::end())
+      it = this->insert(std::make_pair(k, Val())).first;
+    return it->second;
   }
   Val operator[] (const index_t &k) const
   {
     typename maptype::const_iterator it = this->find(k);
-      return it == this->end().it? Val() : it->second;
+      return it == maptype::end()? Val() : it->second;
+  }
+
+  typename maptype::iterator find (const index_t &k)
+  {
+    const std::size_t slot = this->hash_slot(k);
+    if (slot == invalid_slot)
+      return maptype::find(k);
+    if (_hash_table[slot].first == empty_key)
+      return maptype::end();
+    return _hash_table[slot].second;
+  }
+
+  typename maptype::const_iterator find (const index_t &k) const
+  {
+    return const_cast<mapvector*>(this)->find(k);
+  }
+
+  typename maptype::size_type count (const index_t &k) const
+  {
+    return (this->find(k) != maptype::end());
+  }
+
+  std::pair<typename maptype::iterator, bool>
+  insert (const typename maptype::value_type &v)
+  {
+    std::pair<typename maptype::iterator, bool> result =
+      maptype::insert(v);
+    if (result.second)
+      this->hash_insert(result.first);
+    return result;
   }
 
   class veclike_iterator
@@ -114,13 +174,31 @@ public:
   };
 
   void erase(index_t i) {
-      maptype::erase(i);
+      typename maptype::iterator it = this->find(i);
+      if (it != maptype::end())
+        {
+          this->hash_erase(i);
+          maptype::erase(it);
+        }
   }
 
   void erase(const veclike_iterator &pos) {
+      this->hash_erase(pos.it->first);
       maptype::erase(pos.it);
   }
 
+  void clear() {
+      maptype::clear();
+      _hash_table.clear();
+      _n_hashed = 0;
+  }
+
+  void swap(mapvector &other) {
+      maptype::swap(other);
+      _hash_table.swap(other._hash_table);
+      std::swap(_n_hashed, other._n_hashed);
+  }
+
   veclike_iterator begin() {
     return veclike_iterator(maptype::begin());
   }
@@ -136,8 +214,137 @@ public:
   const_veclike_iterator end() const {
     return const_veclike_iterator(maptype::end());
   }
+
+private:
+
+  typedef std::pair<index_t, typename maptype::iterator> hash_entry;
+
+  /**
+   * Marks an unused hash table slot.  An entry with this index, if
+   * any, is found by searching the map itself.
+   */
+  static const index_t empty_key = static_cast<index_t>(-1);
+
+  static const std::size_t invalid_slot = static_cast<std::size_t>(-1);
+
+  static std::size_t hash (const index_t k)
+  {
+    std::size_t h = static_cast<std::size_t>(k);
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h;
+  }
+
+  /**
+   * @returns the slot holding index \p k, or the empty slot where it
+   * would be inserted, or \p invalid_slot if \p k cannot be hashed.
+   */
+  std::size_t hash_slot (const index_t k) const
+  {
+    if (k == empty_key || _hash_table.empty())
+      return invalid_slot;
+
+    const std::size_t mask = _hash_table.size() - 1;
+    std::size_t slot = hash(k) & mask;
+    while (_hash_table[slot].first != k &&
+           _hash_table[slot].first != empty_key)
+      slot = (slot + 1) & mask;
+
+    return slot;
+  }
+
+  void hash_insert (const typename maptype::iterator &it)
+  {
+    if (it->first == empty_key)
+      return;
+
+    // Keep the load factor at or below one half
+    if (2*(_n_hashed + 1) > _hash_table.size())
+      this->rehash(std::max(std::size_t(16), 2*_hash_table.size()));
+    else
+      {
+        const std::size_t slot = this->hash_slot(it->first);
+        _hash_table[slot] = hash_entry(it->first, it);
+        _n_hashed++;
+      }
+  }
+
+  void hash_erase (const index_t k)
+  {
+    std::size_t slot = this->hash_slot(k);
+    if (slot == invalid_slot || _hash_table[slot].first == empty_key)
+      return;
+
+    // Backward-shift deletion: move later entries of the same probe
+    // sequence into the hole so no tombstones are needed.
+    const std::size_t mask = _hash_table.size() - 1;
+    std::size_t next = slot;
+    while (true)
+      {
+        next = (next + 1) & mask;
+        const index_t next_key = _hash_table[next].first;
+        if (next_key == empty_key)
+          break;
+
+        const std::size_t home = hash(next_key) & mask;
+        const bool home_in_gap = (slot <= next) ?
+          (slot < home && home <= next) :
+          (slot < home || home <= next);
+        if (home_in_gap)
+          continue;
+
+        _hash_table[slot] = _hash_table[next];
+        slot = next;
+      }
+
+    _hash_table[slot].first = empty_key;
+    _n_hashed--;
+  }
+
+  /**
+   * Rebuilds the hash table with \p new_size slots (rounded up to a
+   * power of two large enough for every entry in the map).
+   */
+  void rehash (std::size_t new_size)
+  {
+    std::size_t min_size = 2*maptype::size();
+    std::size_t size = 1;
+    while (size < new_size || size < min_size)
+      size *= 2;
+
+    _hash_table.assign(size, hash_entry(empty_key, typename maptype::iterator()));
+    _n_hashed = 0;
+
+    if (maptype::empty())
+      {
+        _hash_table.clear();
+        return;
+      }
+
+    const typename maptype::iterator end = maptype::end();
+    for (typename maptype::iterator it = maptype::begin(); it != end; ++it)
+      if (it->first != empty_key)
+        {
+          const std::size_t slot = this->hash_slot(it->first);
+          _hash_table[slot] = hash_entry(it->first, it);
+          _n_hashed++;
+        }
+  }
+
+  std::vector<hash_entry> _hash_table;
+
+  std::size_t _n_hashed;
 };
 
+
+
+template <typename Val, typename index_t>
+const index_t mapvector<Val,index_t>::empty_key;
+
+template <typename Val, typename index_t>
+const std::size_t mapvector<Val,index_t>::invalid_slot;
+
 } // namespace libMesh
 
 #endif // LIBMESH_MAPVECTOR_H
@@ -27,14 +27,37 @@
 // C++ includes
 #include <cstddef>
 #include <map>
-#include <stack>
 #include <string>
+#include <utility>
 #include <vector>
 #include <sys/time.h>
+#include <time.h>
 
 namespace libMesh
 {
 
+/**
+ * @returns the current time in seconds.  Uses a monotonic clock
+ * where one is available, so that event timings are unaffected by
+ * adjustments to the system time, and falls back on \p gettimeofday()
+ * otherwise.  Only differences between two calls are meaningful.
+ */
+inline
+double perf_log_time ()
+{
+#if defined(LIBMESH_HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return static_cast<double>(t.tv_sec) + static_cast<double>(t.tv_nsec)*1.e-9;
+#else
+  struct timeval t;
+  gettimeofday (&t, NULL);
+  return static_cast<double>(t.tv_sec) + static_cast<double>(t.tv_usec)*1.e-6;
+#endif
+}
+
+
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -52,8 +75,8 @@ class PerfData
   PerfData () :
     tot_time(0.),
     tot_time_incl_sub(0.),
-    tstart(),
-    tstart_incl_sub(),
+    tstart(0.),
+    tstart_incl_sub(0.),
     count(0),
     open(false),
     called_recursively(0)
@@ -71,16 +94,16 @@ class PerfData
   double tot_time_incl_sub;
 
   /**
-   * Structure defining when the event
-   * was last started.
+   * The time at which the event
+   * was last started or resumed.
    */
-  struct timeval tstart;
+  double tstart;
 
   /**
-   * Structure defining when the event
+   * The time at which the event
    * was last started, including sub-events.
    */
-  struct timeval tstart_incl_sub;
+  double tstart_incl_sub;
 
   /**
    * The number of times this event has
@@ -116,6 +139,12 @@ class PerfData
  * This class is particulary useful for finding performance
  * bottlenecks.
  *
+ * Every (header, label) pair is interned once as an integer event
+ * id, and each thread keeps its own stack of running events and its
+ * own timings, which are only summed when the log is printed.  Events
+ * may therefore be logged from inside threaded loops.  Optionally a
+ * timeline of every event can be recorded and written out in the
+ * Chrome trace format with \p write_trace().
  */
 
 // ------------------------------------------------------------
@@ -164,6 +193,28 @@ class PerfLog
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * @returns the id of the event \p label in section \p header,
+   * registering the event if it has not been seen before.  Ids are
+   * never reused, not even by \p clear(), so callers may cache them;
+   * the \p START_LOG and \p STOP_LOG macros do so in static
+   * variables.
+   */
+  unsigned int event_id (const std::string &label,
+			 const std::string &header="");
+
+  /**
+   * Push the event \p event onto the stack of the calling thread,
+   * pausing any active event of that thread.
+   */
+  void push (const unsigned int event);
+
+  /**
+   * Pop the event \p event off the stack of the calling thread,
+   * resuming any lower event of that thread.
+   */
+  void pop (const unsigned int event);
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    */
@@ -176,6 +227,34 @@ class PerfLog
   void pop (const std::string &label,
 	    const std::string &header="");
 
+  /**
+   * Starts recording every completed event, with its start time,
+   * duration and thread, for output by \p write_trace().  The trace
+   * grows with every logged call, so this is intended for profiling
+   * runs rather than left on by default.
+   */
+  void enable_trace() { trace_events = true; }
+
+  /**
+   * Stops recording the event timeline.  Events recorded so far are
+   * kept until \p clear().
+   */
+  void disable_trace() { trace_events = false; }
+
+  /**
+   * Returns true iff the event timeline is being recorded.
+   */
+  bool tracing_enabled() const { return trace_events; }
+
+  /**
+   * Writes the recorded event timeline of this processor to \p
+   * filename in the Chrome trace event (JSON) format, which can be
+   * viewed in chrome://tracing or Perfetto.  Events are grouped by
+   * processor id and thread.  Each processor writes its own file, so
+   * callers running in parallel should use distinct names.
+   */
+  void write_trace (const std::string &filename) const;
+
   /**
    * Start monitoring the event named \p label.
    */
@@ -213,7 +292,11 @@ class PerfLog
   std::string get_info_header() const;
 
   /**
-   * @returns a string containing ONLY the log information
+   * @returns a string containing ONLY the log information.  The
+   * active time reported is that of the main thread, while event
+   * times are summed over all threads, so with threads the event
+   * percentages may add up to more than 100%.  The active time of
+   * each thread is then listed as well.
    */
   std::string get_perf_info() const;
 
@@ -230,6 +313,81 @@ class PerfLog
 
  private:
 
+  /**
+   * Objects of this class own per-thread data and are not meant to
+   * be copied.
+   */
+  PerfLog (const PerfLog&);
+
+  /**
+   * An event which is currently running on some thread, and the time
+   * it was started.
+   */
+  struct OpenEvent
+  {
+    OpenEvent (unsigned int e=0, double t=0.) : event(e), start(t) {}
+    unsigned int event;
+    double start;
+  };
+
+  /**
+   * A completed event in the timeline recorded for \p write_trace().
+   */
+  struct TraceEvent
+  {
+    TraceEvent (unsigned int e=0, double t=0., double d=0.) :
+      event(e), start(t), duration(d) {}
+    unsigned int event;
+    double start;
+    double duration;
+  };
+
+  /**
+   * Everything one thread records: its timings, indexed by event id,
+   * its stack of running events, and optionally its timeline.
+   */
+  struct ThreadLog
+  {
+    ThreadLog () : thread_id(0), total_time(0.) {}
+    unsigned int thread_id;
+    double total_time;
+    std::vector<PerfData> events;
+    std::vector<OpenEvent> stack;
+    std::vector<TraceEvent> trace;
+  };
+
+  /**
+   * The container of \p ThreadLog objects, one per thread that has
+   * logged anything, along with the lock guarding the event registry.
+   * Defined in perf_log.C so that this header need not depend on the
+   * threading library.
+   */
+  class ThreadLogs;
+
+  /**
+   * @returns the \p ThreadLog of the calling thread.
+   */
+  ThreadLog& thread_log ();
+
+  /**
+   * @returns the \p ThreadLog objects of all threads.  Must not be
+   * called while other threads are logging.
+   */
+  std::vector<const ThreadLog*> all_thread_logs () const;
+
+  /**
+   * Sums the timings of all threads by (header, label).  Returns the
+   * active time of each thread, by thread id, in \p thread_times, and
+   * that of the main thread in \p active_time.
+   */
+  void gather_log (std::map<std::pair<std::string, std::string>, PerfData> &log,
+		   double &active_time,
+		   std::vector<double> &thread_times) const;
+
+  /**
+   * @returns the (header, label) pair of event \p event.
+   */
+  std::pair<std::string, std::string> event_name (const unsigned int event) const;
 
   /**
    * The label for this object.
@@ -242,26 +400,32 @@ class PerfLog
   bool log_events;
 
   /**
-   * The total running time for recorded events.
+   * Flag to record the timeline of events for \p write_trace().
    */
-  double total_time;
+  bool trace_events;
 
   /**
    * The time we were constructed or last cleared.
    */
-  struct timeval tstart;
+  double tstart;
 
   /**
-   * The actual log.
+   * Maps each (header, label) pair to its event id.
    */
   std::map<std::pair<std::string,
 		     std::string>,
-	   PerfData> log;
+	   unsigned int> event_ids;
+
+  /**
+   * The (header, label) pair of each event id.
+   */
+  std::vector<std::pair<std::string,
+			std::string> > event_names;
 
   /**
-   * A stack to hold the current performance log trace.
+   * The per-thread logs.
    */
-  std::stack<PerfData*> log_stack;
+  ThreadLogs *thread_logs;
 
   /**
    * Flag indicating if print_log() has been called.
@@ -287,7 +451,7 @@ void PerfData::start ()
 {
   this->count++;
   this->called_recursively++;
-  gettimeofday (&(this->tstart), NULL);
+  this->tstart = perf_log_time();
   this->tstart_incl_sub = this->tstart;
 }
 
@@ -296,7 +460,7 @@ void PerfData::start ()
 inline
 void PerfData::restart ()
 {
-  gettimeofday (&(this->tstart), NULL);
+  this->tstart = perf_log_time();
 }
 
 
@@ -311,26 +475,16 @@ double PerfData::pause ()
 inline
 double PerfData::stop_or_pause(const bool do_stop)
 {
-  // save the start times, reuse the structure we have rather than create
-  // a new one.
-  const time_t
-    tstart_tv_sec  = this->tstart.tv_sec,
-    tstart_tv_usec = this->tstart.tv_usec;
+  const double tnow = perf_log_time();
 
-  gettimeofday (&(this->tstart), NULL);
-
-  const double elapsed_time = (static_cast<double>(this->tstart.tv_sec  - tstart_tv_sec) +
-			       static_cast<double>(this->tstart.tv_usec - tstart_tv_usec)*1.e-6);
+  const double elapsed_time = tnow - this->tstart;
 
   this->tot_time += elapsed_time;
 
   if(do_stop)
-    {
-      const double elapsed_time_incl_sub = (static_cast<double>(this->tstart.tv_sec  - this->tstart_incl_sub.tv_sec) +
-					    static_cast<double>(this->tstart.tv_usec - this->tstart_incl_sub.tv_usec)*1.e-6);
+    this->tot_time_incl_sub += tnow - this->tstart_incl_sub;
 
-      this->tot_time_incl_sub += elapsed_time_incl_sub;
-    }
+  this->tstart = tnow;
 
   return elapsed_time;
 }
@@ -356,53 +510,17 @@ void PerfLog::push (const std::string &label,
 		    const std::string &header)
 {
   if (this->log_events)
-    {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData *perf_data = &(log[std::make_pair(header,label)]);
-
-      if (!log_stack.empty())
-	total_time +=
-	  log_stack.top()->pause();
-
-      perf_data->start();
-      log_stack.push(perf_data);
-    }
+    this->push(this->event_id(label, header));
 }
 
 
 
 inline
-void PerfLog::pop (const std::string &libmesh_dbg_var(label),
-		   const std::string &libmesh_dbg_var(header))
+void PerfLog::pop (const std::string &label,
+		   const std::string &header)
 {
   if (this->log_events)
-    {
-      libmesh_assert (!log_stack.empty());
-
-#ifndef NDEBUG
-      PerfData *perf_data = &(log[std::make_pair(header,label)]);
-      if (perf_data != log_stack.top())
-        {
-          std::cerr << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
-          std::cerr << "From top of stack of running logs:" << std::endl;
-          std::map<std::pair<std::string, std::string>, PerfData>::iterator
-            i = log.begin(), endi = log.end();
-          for (; i != endi; ++i)
-            if (&(i->second) == log_stack.top())
-              std::cerr << '(' << i->first.first << ',' << i->first.second << ')' << std::endl;
-
-          libmesh_assert_equal_to (perf_data, log_stack.top());
-        }
-#endif
-
-      total_time += log_stack.top()->stopit();
-
-      log_stack.pop();
-
-      if (!log_stack.empty())
-	log_stack.top()->restart();
-    }
+    this->pop(this->event_id(label, header));
 }
 
 
@@ -410,13 +528,7 @@ void PerfLog::pop (const std::string &libmesh_dbg_var(label),
 inline
 double PerfLog::get_elapsed_time () const
 {
-  struct timeval tnow;
-
-  gettimeofday (&tnow, NULL);
-
-  const double elapsed_time = (static_cast<double>(tnow.tv_sec  - tstart.tv_sec) +
-			       static_cast<double>(tnow.tv_usec - tstart.tv_usec)*1.e-6);
-  return elapsed_time;
+  return perf_log_time() - tstart;
 }
 
 
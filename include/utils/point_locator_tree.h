@@ -23,6 +23,7 @@
 // Local Includes
 #include "libmesh/point_locator_base.h"
 #include "libmesh/tree_base.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
@@ -111,7 +112,9 @@ public:
    * Locates the element in which the point with global coordinates
    * \p p is located.  The mutable _element member is used to cache
    * the result and allow it to be used during the next call to
-   * operator().
+   * operator().  The cache is guarded by a spin lock, so concurrent
+   * calls from several threads are safe; the tree itself is only
+   * read.
    */
   virtual const Elem* operator() (const Point& p) const;
 
@@ -146,6 +149,11 @@ protected:
    */
   mutable const Elem* _element;
 
+  /**
+   * Guards \p _element against concurrent \p operator() calls.
+   */
+  mutable Threads::spin_mutex _element_mutex;
+
   /**
    * \p true if out-of-mesh mode is enabled.  See \p
    * enable_out_of_mesh_mode() for details.
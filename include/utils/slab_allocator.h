@@ -0,0 +1,145 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_SLAB_ALLOCATOR_H
+#define LIBMESH_SLAB_ALLOCATOR_H
+
+#include "libmesh/libmesh_config.h"
+
+// C++ includes
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace libMesh
+{
+
+/**
+ * The \p SlabPool hands out small, fixed-size chunks of memory carved
+ * from large contiguous slabs.  Requests are grouped into size classes
+ * of 16 bytes, and each size class is carved from its own slabs, so
+ * objects of the same type (e.g. all \p Hex8 elements, or all \p Node
+ * objects) are packed next to one another in the order in which they
+ * were created.  Different types whose sizes round up to the same
+ * size class share slabs.  Freed chunks are recycled by later
+ * requests of the same size class.  Requests larger than
+ * \p max_chunk_bytes are forwarded to the global \p operator \p new.
+ *
+ * Slabs are never returned to the operating system; memory freed by
+ * one mesh is reused by the next.  All methods are thread-safe.
+ */
+class SlabPool
+{
+public:
+
+  /**
+   * Requests of more than this many bytes bypass the pool.
+   */
+  static const std::size_t max_chunk_bytes = 1024;
+
+  /**
+   * @returns a pointer to at least \p bytes bytes of memory, suitably
+   * aligned for any object type.
+   */
+  static void * allocate (std::size_t bytes);
+
+  /**
+   * Returns the chunk \p p, which must have been obtained from
+   * \p allocate() with the same value of \p bytes, to the pool.
+   */
+  static void deallocate (void * p, std::size_t bytes);
+
+  /**
+   * @returns the number of bytes currently held in slabs, whether
+   * in use or on a free list.
+   */
+  static std::size_t slab_bytes ();
+};
+
+
+
+/**
+ * A standard-conforming allocator which obtains its storage from the
+ * \p SlabPool.  This is used for the many small index buffers owned
+ * by \p DofObject instances, which would otherwise each be a separate
+ * heap allocation.
+ */
+template <typename T>
+class SlabAllocator
+{
+public:
+  typedef T              value_type;
+  typedef T*             pointer;
+  typedef const T*       const_pointer;
+  typedef T&             reference;
+  typedef const T&       const_reference;
+  typedef std::size_t    size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  /**
+   * Methods required for copy construction of containers using this allocator.
+   */
+  template <typename U>
+  struct rebind {
+    typedef SlabAllocator<U> other;
+  };
+
+  SlabAllocator () {}
+
+  SlabAllocator (const SlabAllocator &) {}
+
+  template <typename U>
+  SlabAllocator (const SlabAllocator<U> &) {}
+
+  pointer address (reference x) const { return &x; }
+
+  const_pointer address (const_reference x) const { return &x; }
+
+  pointer allocate (size_type n, const void * = 0)
+  {
+    if (n > this->max_size())
+      throw std::bad_alloc();
+
+    return static_cast<pointer>(SlabPool::allocate(n*sizeof(T)));
+  }
+
+  void deallocate (pointer p, size_type n)
+  { SlabPool::deallocate(p, n*sizeof(T)); }
+
+  size_type max_size () const
+  { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+  void construct (pointer p, const T & val) { new (static_cast<void*>(p)) T(val); }
+
+  void destroy (pointer p) { p->~T(); }
+};
+
+
+
+template <typename T, typename U>
+inline
+bool operator== (const SlabAllocator<T> &, const SlabAllocator<U> &)
+{ return true; }
+
+template <typename T, typename U>
+inline
+bool operator!= (const SlabAllocator<T> &, const SlabAllocator<U> &)
+{ return false; }
+
+} // namespace libMesh
+
+#endif // LIBMESH_SLAB_ALLOCATOR_H
@@ -133,6 +133,14 @@ public:
   void transform_nodes_to_elements (std::vector<std::vector<const Elem*> >&
 				    nodes_to_elem);
 
+  /**
+   * Computes the padded bounding boxes of the elements in each
+   * active node, which find_element() tests before asking an element
+   * whether it contains a point.  Must be called once the tree has
+   * been built, and again if any element moves.
+   */
+  void build_element_bounds ();
+
   /**
    * @returns the number of active bins below
    * (including) this element.
@@ -140,7 +148,8 @@ public:
   unsigned int n_active_bins() const;
 
   /**
-   * @returns an element containing point p.
+   * @returns an element containing point p.  Does not modify the
+   * tree, so may be called from several threads at once.
    */
   const Elem* find_element (const Point& p) const;
 
@@ -192,6 +201,18 @@ private:
    */
   std::vector<const Elem*> elements;
 
+  /**
+   * The bounding boxes of \p elements, padded just as
+   * \p Elem::contains_point() pads them, with one array of minima and
+   * one of maxima per coordinate.  Elements which are not first order
+   * get an unbounded box, just as they skip the box test in
+   * \p Elem::contains_point().  Most elements which cannot contain a point are
+   * rejected with a few comparisons against these contiguous arrays
+   * rather than an inverse map.
+   */
+  std::vector<Real> element_min[LIBMESH_DIM];
+  std::vector<Real> element_max[LIBMESH_DIM];
+
   /**
    * The node numbers contained in this portion of the tree.
    */
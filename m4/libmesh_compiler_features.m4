@@ -121,6 +121,12 @@ AC_CXX_RTTI
 AC_CHECK_HEADERS(getopt.h)
 AC_CHECK_HEADERS(csignal)
 AC_CHECK_HEADERS(sys/resource.h)
+
+# Check for clock_gettime(), which the performance log prefers for its
+# monotonic clock.  Older glibc keeps it in librt.
+AC_SEARCH_LIBS([clock_gettime],[rt],
+               [AC_DEFINE(HAVE_CLOCK_GETTIME, 1,
+                          [Flag indicating whether clock_gettime() is available])])
 AC_CXX_HAVE_LOCALE
 AC_CXX_HAVE_SSTREAM
 
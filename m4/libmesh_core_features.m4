@@ -323,6 +323,26 @@ fi
 
 
 
+# -------------------------------------------------------------
+# Slab allocation of nodes, elements and their DoF index buffers
+# -- disabled by default
+# -------------------------------------------------------------
+AC_ARG_ENABLE(slab-allocation,
+              AC_HELP_STRING([--enable-slab-allocation],
+                             [Allocate mesh nodes and elements from contiguous slabs]),
+              enableslaballocation=$enableval,
+              enableslaballocation=no)
+
+if test "$enableslaballocation" != no ; then
+  AC_DEFINE(ENABLE_SLAB_ALLOCATION, 1,
+	   [Flag indicating if nodes, elements and DofObject index buffers
+should be allocated from contiguous memory slabs])
+  AC_MSG_RESULT(<<< Configuring library with slab allocation of mesh objects >>>)
+fi
+# -------------------------------------------------------------
+
+
+
 # -------------------------------------------------------------
 # Ghosted instead of Serial local vectors -- enabled by default
 # -------------------------------------------------------------
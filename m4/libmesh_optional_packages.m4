@@ -179,6 +179,16 @@ if (test "$enablebz2" != no) ; then
                    [Flag indicating bzip2/bunzip2 are available for handling compressed .bz2 files])
        fi
    fi
+
+   # Prefer compressing in-process with libbz2 when we can
+   AC_CHECK_HEADERS(bzlib.h, have_bzlib_h=yes)
+   AC_CHECK_LIB(bz2, BZ2_bzBuffToBuffCompress, have_libbz2=yes)
+   if (test "$have_bzlib_h" = yes -a "$have_libbz2" = yes) ; then
+      AC_MSG_RESULT(<<< Using libbz2 for writing/reading compressed .bz2 files >>>)
+      AC_DEFINE(HAVE_LIBBZ2, 1,
+                [Flag indicating libbz2 is available for in-process handling of compressed .bz2 files])
+      libmesh_optional_LIBS="-lbz2 $libmesh_optional_LIBS"
+   fi
 fi
 # -------------------------------------------------------------
 
@@ -200,6 +210,16 @@ if (test "$enablexz" != no) ; then
       AC_DEFINE(HAVE_XZ, 1,
                 [Flag indicating xz is available for handling compressed .xz files])
    fi
+
+   # Prefer compressing in-process with a multithreaded liblzma when we can
+   AC_CHECK_HEADERS(lzma.h, have_lzma_h=yes)
+   AC_CHECK_LIB(lzma, lzma_stream_encoder_mt, have_liblzma=yes)
+   if (test "$have_lzma_h" = yes -a "$have_liblzma" = yes) ; then
+      AC_MSG_RESULT(<<< Using liblzma for writing/reading compressed .xz files >>>)
+      AC_DEFINE(HAVE_LIBLZMA, 1,
+                [Flag indicating a multithreaded liblzma is available for in-process handling of compressed .xz files])
+      libmesh_optional_LIBS="-llzma $libmesh_optional_LIBS"
+   fi
 fi
 # -------------------------------------------------------------
 